@@ -1,5 +1,7 @@
 ##############################################################################
-ifndef EMSCRIPTEN
+ifdef HOST
+BUILD = ./build-host
+else ifndef EMSCRIPTEN
 BUILD = ./build
 else
 BUILD = ./build-sim
@@ -45,7 +47,59 @@ ifeq ($(DETECTED_OS), WINDOWS)
   MAKEFLAGS += -j $(NUMBER_OF_PROCESSORS)
 endif
 
-ifndef EMSCRIPTEN
+ifdef HOST
+
+CFLAGS += -W -Wall -Wextra -Wmissing-prototypes -Wmissing-declarations
+CFLAGS += -Wno-format -Wno-unused-parameter
+CFLAGS += --std=gnu99 -Og -g
+CFLAGS += -funsigned-char -funsigned-bitfields
+CFLAGS += -MD -MP -MT $(BUILD)/$(*F).o -MF $(BUILD)/$(@F).d
+
+LIBS += -lm
+
+INCLUDES += \
+  -I$(TOP)/boards/$(BOARD) \
+  -I$(TOP)/watch-library/shared/driver/ \
+  -I$(TOP)/watch-library/shared/config/ \
+  -I$(TOP)/watch-library/shared/watch/ \
+  -I$(TOP)/watch-library/host/watch/ \
+  -I$(TOP)/watch-library/simulator/hpl/port/ \
+  -I$(TOP)/watch-library/hardware/include/component \
+  -I$(TOP)/watch-library/hardware/hal/include/ \
+  -I$(TOP)/watch-library/hardware/hal/utils/include/ \
+  -I$(TOP)/watch-library/hardware/hpl/slcd/ \
+  -I$(TOP)/watch-library/hardware/hw/ \
+
+SRCS += \
+  $(TOP)/watch-library/host/main.c \
+  $(TOP)/watch-library/host/watch/watch_host.c \
+  $(TOP)/watch-library/host/watch/watch_rtc.c \
+  $(TOP)/watch-library/host/watch/watch_slcd.c \
+  $(TOP)/watch-library/host/watch/watch_extint.c \
+  $(TOP)/watch-library/host/watch/watch_led.c \
+  $(TOP)/watch-library/host/watch/watch_buzzer.c \
+  $(TOP)/watch-library/host/watch/watch_adc.c \
+  $(TOP)/watch-library/host/watch/watch_gpio.c \
+  $(TOP)/watch-library/host/watch/watch_i2c.c \
+  $(TOP)/watch-library/host/watch/watch_spi.c \
+  $(TOP)/watch-library/host/watch/watch_uart.c \
+  $(TOP)/watch-library/host/watch/watch_storage.c \
+  $(TOP)/watch-library/host/watch/watch_deepsleep.c \
+  $(TOP)/watch-library/host/watch/watch_private.c \
+  $(TOP)/watch-library/host/watch/watch.c \
+  $(TOP)/watch-library/shared/driver/thermistor_driver.c \
+  $(TOP)/watch-library/shared/driver/lis2dw.c \
+  $(TOP)/watch-library/shared/driver/opt3001.c \
+  $(TOP)/watch-library/shared/driver/spiflash.c \
+  $(TOP)/watch-library/shared/driver/spiflash_log.c \
+  $(TOP)/watch-library/shared/watch/watch_private_buzzer.c \
+  $(TOP)/watch-library/shared/watch/watch_private_display.c \
+  $(TOP)/watch-library/shared/watch/watch_utility.c \
+
+DEFINES += \
+  -DWATCH_HOST=1
+
+else ifndef EMSCRIPTEN
 CC = arm-none-eabi-gcc
 OBJCOPY = arm-none-eabi-objcopy
 SIZE = arm-none-eabi-size
@@ -154,6 +208,7 @@ SRCS += \
   $(TOP)/watch-library/shared/driver/lis2dw.c \
   $(TOP)/watch-library/shared/driver/opt3001.c \
   $(TOP)/watch-library/shared/driver/spiflash.c \
+  $(TOP)/watch-library/shared/driver/spiflash_log.c \
   $(TOP)/watch-library/shared/watch/watch_private_buzzer.c \
   $(TOP)/watch-library/shared/watch/watch_private_display.c \
   $(TOP)/watch-library/shared/watch/watch_utility.c \
@@ -199,12 +254,18 @@ SRCS += \
   $(TOP)/watch-library/simulator/watch/watch.c \
   $(TOP)/watch-library/shared/driver/thermistor_driver.c \
   $(TOP)/watch-library/shared/driver/opt3001.c \
+  $(TOP)/watch-library/shared/driver/spiflash.c \
   $(TOP)/watch-library/shared/watch/watch_private_buzzer.c \
   $(TOP)/watch-library/shared/watch/watch_private_display.c \
   $(TOP)/watch-library/shared/watch/watch_utility.c \
 
 endif
 
+# watch_private_display.c draws characters from tables that utils/segment_tables.py builds out of
+# watch_private_display.h; the generated header goes in the build directory.
+DISPLAY_TABLES = $(BUILD)/watch_display_tables.h
+INCLUDES += -I$(BUILD)
+
 ifeq ($(LED), BLUE)
 CFLAGS += -DWATCH_IS_BLUE_BOARD
 endif
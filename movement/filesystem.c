@@ -6,11 +6,16 @@
 #include "watch.h"
 #include "lfs.h"
 #include "hpl_flash.h"
+#include "spiflash.h"
 
 int lfs_storage_read(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, void *buffer, lfs_size_t size);
 int lfs_storage_prog(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, const void *buffer, lfs_size_t size);
 int lfs_storage_erase(const struct lfs_config *cfg, lfs_block_t block);
 int lfs_storage_sync(const struct lfs_config *cfg);
+int lfs_spi_flash_read(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, void *buffer, lfs_size_t size);
+int lfs_spi_flash_prog(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, const void *buffer, lfs_size_t size);
+int lfs_spi_flash_erase(const struct lfs_config *cfg, lfs_block_t block);
+int lfs_spi_flash_sync(const struct lfs_config *cfg);
 
 int lfs_storage_read(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, void *buffer, lfs_size_t size) {
     (void) cfg;
@@ -19,7 +24,17 @@ int lfs_storage_read(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t
 
 int lfs_storage_prog(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, const void *buffer, lfs_size_t size) {
     (void) cfg;
-    return !watch_storage_write(block, off, (void *)buffer, size);
+    // littlefs writes out its whole cache at once, but the NVM controller only writes one page at a time.
+    const uint8_t *data = buffer;
+    while (size) {
+        lfs_size_t chunk = min(size, NVMCTRL_PAGE_SIZE - off % NVMCTRL_PAGE_SIZE);
+        if (!watch_storage_write(block, off, data, chunk)) return LFS_ERR_IO;
+        off += chunk;
+        data += chunk;
+        size -= chunk;
+    }
+
+    return LFS_ERR_OK;
 }
 
 int lfs_storage_erase(const struct lfs_config *cfg, lfs_block_t block) {
@@ -32,6 +47,20 @@ int lfs_storage_sync(const struct lfs_config *cfg) {
     return !watch_storage_sync();
 }
 
+// These are tuned with movement/test/storage_benchmark.py, which can also try other values by defining them.
+#ifndef FILESYSTEM_READ_SIZE
+#define FILESYSTEM_READ_SIZE 16
+#endif
+#ifndef FILESYSTEM_CACHE_SIZE
+#define FILESYSTEM_CACHE_SIZE NVMCTRL_PAGE_SIZE
+#endif
+#ifndef FILESYSTEM_LOOKAHEAD_SIZE
+#define FILESYSTEM_LOOKAHEAD_SIZE 16
+#endif
+#ifndef FILESYSTEM_BLOCK_CYCLES
+#define FILESYSTEM_BLOCK_CYCLES 100
+#endif
+
 const struct lfs_config cfg = {
     // block device operations
     .read  = lfs_storage_read,
@@ -40,19 +69,207 @@ const struct lfs_config cfg = {
     .sync  = lfs_storage_sync,
 
     // block device configuration
-    .read_size = 16,
+    .read_size = FILESYSTEM_READ_SIZE,
     .prog_size = NVMCTRL_PAGE_SIZE,
     .block_size = NVMCTRL_ROW_SIZE,
     .block_count = NVMCTRL_RWWEE_PAGES / 4,
-    .cache_size = NVMCTRL_PAGE_SIZE,
-    .lookahead_size = 16,
-    .block_cycles = 100,
+    .cache_size = FILESYSTEM_CACHE_SIZE,
+    .lookahead_size = FILESYSTEM_LOOKAHEAD_SIZE,
+    .block_cycles = FILESYSTEM_BLOCK_CYCLES,
+};
+
+// The external filesystem lives on the SPI NOR flash that sensor boards carry. By default it takes the second half
+// of a 2 MB chip like the W25Q16 on those boards, and leaves the first half to data written to the flash directly,
+// like accelerometer_data_acquisition_face's log. Define these to move it or resize it.
+#ifndef FILESYSTEM_EXTERNAL_FIRST_BLOCK
+#define FILESYSTEM_EXTERNAL_FIRST_BLOCK 256
+#endif
+#ifndef FILESYSTEM_EXTERNAL_BLOCK_COUNT
+#define FILESYSTEM_EXTERNAL_BLOCK_COUNT 256
+#endif
+
+static uint32_t _spi_flash_address(lfs_block_t block, lfs_off_t off) {
+    return (FILESYSTEM_EXTERNAL_FIRST_BLOCK + block) * SPI_FLASH_SECTOR_SIZE + off;
+}
+
+int lfs_spi_flash_read(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, void *buffer, lfs_size_t size) {
+    (void) cfg;
+    return !spi_flash_read_data(_spi_flash_address(block, off), buffer, size);
+}
+
+int lfs_spi_flash_prog(const struct lfs_config *cfg, lfs_block_t block, lfs_off_t off, const void *buffer, lfs_size_t size) {
+    (void) cfg;
+    // as with the NVM controller, a page program can't cross into the next page; it wraps around to the start of its own.
+    const uint8_t *data = buffer;
+    uint32_t address = _spi_flash_address(block, off);
+    while (size) {
+        lfs_size_t chunk = min(size, SPI_FLASH_PAGE_SIZE - address % SPI_FLASH_PAGE_SIZE);
+        if (!spi_flash_command(CMD_ENABLE_WRITE)) return LFS_ERR_IO;
+        if (!spi_flash_write_data(address, (uint8_t *)data, chunk)) return LFS_ERR_IO;
+        // the flash ignores everything but status reads until it's done, so there's no point in leaving this for sync.
+        if (!spi_flash_wait_until_ready()) return LFS_ERR_IO;
+        address += chunk;
+        data += chunk;
+        size -= chunk;
+    }
+
+    return LFS_ERR_OK;
+}
+
+int lfs_spi_flash_erase(const struct lfs_config *cfg, lfs_block_t block) {
+    (void) cfg;
+    if (!spi_flash_command(CMD_ENABLE_WRITE)) return LFS_ERR_IO;
+    if (!spi_flash_sector_command(CMD_SECTOR_ERASE, _spi_flash_address(block, 0))) return LFS_ERR_IO;
+    return !spi_flash_wait_until_ready();
+}
+
+int lfs_spi_flash_sync(const struct lfs_config *cfg) {
+    (void) cfg;
+    // prog and erase have already waited for the flash.
+    return LFS_ERR_OK;
+}
+
+// The caches are a page each, since that's as much as one program can write. The lookahead buffer has a bit for
+// every block, so littlefs only has to scan the filesystem for free blocks once per mount.
+static uint8_t external_read_buffer[SPI_FLASH_PAGE_SIZE];
+static uint8_t external_prog_buffer[SPI_FLASH_PAGE_SIZE];
+static uint32_t external_lookahead_buffer[FILESYSTEM_EXTERNAL_BLOCK_COUNT / 32];
+
+static const struct lfs_config external_cfg = {
+    // block device operations
+    .read  = lfs_spi_flash_read,
+    .prog  = lfs_spi_flash_prog,
+    .erase = lfs_spi_flash_erase,
+    .sync  = lfs_spi_flash_sync,
+
+    // block device configuration. every read costs a command and an address on top of the data, so it isn't worth
+    // reading in units much smaller than this; and the flash can program any number of bytes, so the same goes for
+    // programs.
+    .read_size = 16,
+    .prog_size = 16,
+    .block_size = SPI_FLASH_SECTOR_SIZE,
+    .block_count = FILESYSTEM_EXTERNAL_BLOCK_COUNT,
+    .cache_size = SPI_FLASH_PAGE_SIZE,
+    .lookahead_size = sizeof(external_lookahead_buffer),
+    .block_cycles = 500,
+    .read_buffer = external_read_buffer,
+    .prog_buffer = external_prog_buffer,
+    .lookahead_buffer = external_lookahead_buffer,
 };
 
-static lfs_t lfs;
+// A filesystem we can mount, and the number of blocks it has in use: lfs_fs_traverse reads every one of those to
+// count them, so we keep the count until something changes.
+typedef struct {
+    lfs_t lfs;
+    const struct lfs_config *cfg;
+    int32_t used_blocks;
+    bool mounted;
+} filesystem_mount_t;
+
+static filesystem_mount_t internal = { .cfg = &cfg, .used_blocks = -1 };
+static filesystem_mount_t external = { .cfg = &external_cfg, .used_blocks = -1 };
 static lfs_file_t file;
 static struct lfs_info info;
 
+// Faces tend to ask about the same file several times in a row (does it exist, how big is it, read it), and
+// every lfs_stat walks the metadata pairs from the root. So we remember the type and size of the last few paths
+// we looked up, including ones that don't exist. Anything that changes a file through this module forgets it.
+#define FILESYSTEM_STAT_CACHE_SIZE 4
+#define FILESYSTEM_STAT_CACHE_NAME_MAX 23
+
+typedef struct {
+    char name[FILESYSTEM_STAT_CACHE_NAME_MAX + 1];  // empty if the entry is unused
+    uint8_t type;                                   // 0 if the file doesn't exist
+    int32_t size;
+} filesystem_stat_cache_entry_t;
+
+static filesystem_stat_cache_entry_t stat_cache[FILESYSTEM_STAT_CACHE_SIZE];
+static uint8_t stat_cache_next = 0;
+
+// littlefs doesn't care about leading slashes, so neither do we.
+static const char *_stat_cache_key(const char *filename) {
+    while (*filename == '/') filename++;
+    return filename;
+}
+
+static void _stat_cache_forget(const char *filename) {
+    filename = _stat_cache_key(filename);
+    for (uint8_t i = 0; i < FILESYSTEM_STAT_CACHE_SIZE; i++) {
+        if (!strcmp(stat_cache[i].name, filename)) stat_cache[i].name[0] = 0;
+    }
+}
+
+static void _stat_cache_clear(void) {
+    memset(stat_cache, 0, sizeof(stat_cache));
+}
+
+// Finds the filesystem that a path is on, and the path to hand to littlefs there: paths under
+// FILESYSTEM_EXTERNAL_PREFIX are on the external filesystem, without the prefix, and everything else is on the
+// internal one. Returns NULL if the path is on the external filesystem and it isn't mounted.
+static filesystem_mount_t *_filesystem_resolve(const char *filename, const char **path) {
+    const char *prefix = _stat_cache_key(FILESYSTEM_EXTERNAL_PREFIX);
+    const char *key = _stat_cache_key(filename);
+    size_t length = strlen(prefix) - 1;  // the prefix ends with a slash, but the mount point itself is on it too
+
+    if (strncmp(key, prefix, length) || (key[length] && key[length] != '/')) {
+        *path = filename;
+        return &internal;
+    }
+
+    *path = key[length] ? key + length : "/";
+    return external.mounted ? &external : NULL;
+}
+
+// the one place we look up file metadata. returns the file's type (0 if it doesn't exist) and sets size.
+static uint8_t _filesystem_stat(const char *filename, int32_t *size) {
+    const char *path;
+    filesystem_mount_t *mount = _filesystem_resolve(filename, &path);
+    if (!mount) {
+        *size = 0;
+        return 0;
+    }
+
+    const char *key = _stat_cache_key(filename);
+    bool cacheable = key[0] && strlen(key) <= FILESYSTEM_STAT_CACHE_NAME_MAX;
+
+    if (cacheable) {
+        for (uint8_t i = 0; i < FILESYSTEM_STAT_CACHE_SIZE; i++) {
+            if (!strcmp(stat_cache[i].name, key)) {
+                *size = stat_cache[i].size;
+                return stat_cache[i].type;
+            }
+        }
+    }
+
+    info.type = 0;
+    info.size = 0;
+    int err = lfs_stat(&mount->lfs, path, &info);
+    // don't remember I/O errors; only whether the file is there or not.
+    if (err < 0 && err != LFS_ERR_NOENT) {
+        *size = 0;
+        return 0;
+    }
+
+    if (cacheable) {
+        filesystem_stat_cache_entry_t *entry = &stat_cache[stat_cache_next];
+        stat_cache_next = (stat_cache_next + 1) % FILESYSTEM_STAT_CACHE_SIZE;
+        strcpy(entry->name, key);
+        entry->type = info.type;
+        entry->size = info.size;
+    }
+
+    *size = info.size;
+    return info.type;
+}
+
+// call before anything that writes to or removes filename.
+static void _filesystem_will_change(const char *filename) {
+    const char *path;
+    filesystem_mount_t *mount = _filesystem_resolve(filename, &path);
+    _stat_cache_forget(filename);
+    if (mount) mount->used_blocks = -1;
+}
+
 static int _traverse_df_cb(void *p, lfs_block_t block) {
     (void) block;
 	uint32_t *nb = p;
@@ -60,18 +277,38 @@ static int _traverse_df_cb(void *p, lfs_block_t block) {
 	return 0;
 }
 
+static int32_t _filesystem_get_used_blocks(filesystem_mount_t *mount) {
+    if (mount->used_blocks < 0) {
+        uint32_t blocks = 0;
+        int err = lfs_fs_traverse(&mount->lfs, _traverse_df_cb, &blocks);
+        if (err < 0) return err;
+        mount->used_blocks = blocks;
+    }
+
+    return mount->used_blocks;
+}
+
+static int32_t _filesystem_get_free_space(filesystem_mount_t *mount) {
+    int32_t blocks = _filesystem_get_used_blocks(mount);
+    if (blocks < 0) return blocks;
+
+    return (int32_t)((mount->cfg->block_count - blocks) * mount->cfg->block_size);
+}
+
 int32_t filesystem_get_free_space(void) {
-	int err;
+    return _filesystem_get_free_space(&internal);
+}
 
-	uint32_t free_blocks = 0;
-	err = lfs_fs_traverse(&lfs, _traverse_df_cb, &free_blocks);
-	if(err < 0){
-		return err;
-	}
+int32_t filesystem_get_used_space(void) {
+    int32_t blocks = _filesystem_get_used_blocks(&internal);
+    if (blocks < 0) return blocks;
 
-	uint32_t available = cfg.block_count * cfg.block_size - free_blocks * cfg.block_size;
+    return (int32_t)(blocks * cfg.block_size);
+}
 
-	return (int32_t)available;
+int32_t filesystem_get_external_free_space(void) {
+    if (!external.mounted) return LFS_ERR_INVAL;
+    return _filesystem_get_free_space(&external);
 }
 
 static int filesystem_ls(lfs_t *lfs, const char *path) {
@@ -112,32 +349,108 @@ static int filesystem_ls(lfs_t *lfs, const char *path) {
 }
 
 bool filesystem_init(void) {
-    int err = lfs_mount(&lfs, &cfg);
+    _stat_cache_clear();
+    internal.used_blocks = -1;
+    int err = lfs_mount(&internal.lfs, &cfg);
 
     // reformat if we can't mount the filesystem
     // this should only happen on the first boot
     if (err < 0) {
         printf("Ignore that error! Formatting filesystem...\r\n");
-        err = lfs_format(&lfs, &cfg);
+        err = lfs_format(&internal.lfs, &cfg);
         if (err < 0) return false;
-        err = lfs_mount(&lfs, &cfg) == LFS_ERR_OK;
+        err = lfs_mount(&internal.lfs, &cfg);
         printf("Filesystem mounted with %ld bytes free.\r\n", filesystem_get_free_space());
     }
 
-    return err == LFS_ERR_OK;
+    internal.mounted = err == LFS_ERR_OK;
+    return internal.mounted;
+}
+
+static bool _external_flash_is_present(void) {
+    // a board without the flash chip reads back all ones or all zeros, and we don't want to wait on its status.
+    uint8_t jedec_id[3] = {0};
+    spi_flash_init();
+    if (!spi_flash_read_command(CMD_READ_JEDEC_ID, jedec_id, sizeof(jedec_id))) return false;
+    if (jedec_id[0] == 0x00 || jedec_id[0] == 0xFF) return false;
+    return spi_flash_wait_until_ready();
+}
+
+// whether every byte of the external filesystem's range reads back erased. this reads the whole range, which
+// takes a while, but it only happens when there's no filesystem to mount.
+static bool _external_range_is_erased(void) {
+    // nothing is mounted, so littlefs isn't using its read cache.
+    uint8_t *buffer = external_read_buffer;
+    bool erased = true;
+
+    if (!spi_flash_stream_open(_spi_flash_address(0, 0))) return false;
+    for(uint32_t left = FILESYSTEM_EXTERNAL_BLOCK_COUNT * SPI_FLASH_SECTOR_SIZE; erased && left; left -= SPI_FLASH_PAGE_SIZE) {
+        erased = spi_flash_stream_read(buffer, SPI_FLASH_PAGE_SIZE);
+        for(uint16_t i = 0; erased && i < SPI_FLASH_PAGE_SIZE; i++) erased = buffer[i] == 0xFF;
+    }
+    spi_flash_stream_close();
+
+    return erased;
+}
+
+static bool _filesystem_format_and_mount_external(void) {
+    printf("Formatting external filesystem...\r\n");
+    int err = lfs_format(&external.lfs, &external_cfg);
+    if (err == LFS_ERR_OK) err = lfs_mount(&external.lfs, &external_cfg);
+
+    external.mounted = err == LFS_ERR_OK;
+    return external.mounted;
+}
+
+bool filesystem_mount_external(void) {
+    if (external.mounted) return true;
+    if (!_external_flash_is_present()) return false;
+
+    _stat_cache_clear();
+    external.used_blocks = -1;
+    if (lfs_mount(&external.lfs, &external_cfg) == LFS_ERR_OK) {
+        external.mounted = true;
+        return true;
+    }
+
+    // a blank range is one we can have for the asking. anything else is either a damaged filesystem or somebody
+    // else's data, and wiping it out is for filesystem_format_external to do, when asked.
+    if (!_external_range_is_erased()) {
+        printf("No external filesystem, and the flash isn't blank; not formatting it.\r\n");
+        return false;
+    }
+
+    return _filesystem_format_and_mount_external();
+}
+
+bool filesystem_format_external(void) {
+    filesystem_unmount_external();
+    if (!_external_flash_is_present()) return false;
+
+    _stat_cache_clear();
+    external.used_blocks = -1;
+    return _filesystem_format_and_mount_external();
+}
+
+void filesystem_unmount_external(void) {
+    if (!external.mounted) return;
+
+    lfs_unmount(&external.lfs);
+    external.mounted = false;
+    _stat_cache_clear();
 }
 
 bool filesystem_file_exists(char *filename) {
-    info.type = 0;
-    lfs_stat(&lfs, filename, &info);
-    return info.type == LFS_TYPE_REG;
+    int32_t size;
+    return _filesystem_stat(filename, &size) == LFS_TYPE_REG;
 }
 
 bool filesystem_rm(char *filename) {
-    info.type = 0;
-    lfs_stat(&lfs, filename, &info);
+    const char *path;
+    filesystem_mount_t *mount = _filesystem_resolve(filename, &path);
     if (filesystem_file_exists(filename)) {
-        return lfs_remove(&lfs, filename) == LFS_ERR_OK;
+        _filesystem_will_change(filename);
+        return lfs_remove(&mount->lfs, path) == LFS_ERR_OK;
     } else {
         printf("rm: %s: No such file\r\n", filename);
         return false;
@@ -145,36 +458,41 @@ bool filesystem_rm(char *filename) {
 }
 
 int32_t filesystem_get_file_size(char *filename) {
-    if (filesystem_file_exists(filename)) {
-        return info.size; // info struct was just populated by filesystem_file_exists
+    int32_t size;
+    if (_filesystem_stat(filename, &size) == LFS_TYPE_REG) {
+        return size;
     }
 
     return -1;
 }
 
 bool filesystem_read_file(char *filename, char *buf, int32_t length) {
+    const char *path;
+    filesystem_mount_t *mount = _filesystem_resolve(filename, &path);
     memset(buf, 0, length);
     int32_t file_size = filesystem_get_file_size(filename);
     if (file_size > 0) {
-        int err = lfs_file_open(&lfs, &file, filename, LFS_O_RDONLY);
+        int err = lfs_file_open(&mount->lfs, &file, path, LFS_O_RDONLY);
         if (err < 0) return false;
-        err = lfs_file_read(&lfs, &file, buf, min(length, file_size));
+        err = lfs_file_read(&mount->lfs, &file, buf, min(length, file_size));
         if (err < 0) return false;
-        return lfs_file_close(&lfs, &file) == LFS_ERR_OK;
+        return lfs_file_close(&mount->lfs, &file) == LFS_ERR_OK;
     }
 
     return false;
 }
 
 bool filesystem_read_line(char *filename, char *buf, int32_t *offset, int32_t length) {
+    const char *path;
+    filesystem_mount_t *mount = _filesystem_resolve(filename, &path);
     memset(buf, 0, length + 1);
     int32_t file_size = filesystem_get_file_size(filename);
     if (file_size > 0) {
-        int err = lfs_file_open(&lfs, &file, filename, LFS_O_RDONLY);
+        int err = lfs_file_open(&mount->lfs, &file, path, LFS_O_RDONLY);
         if (err < 0) return false;
-        err = lfs_file_seek(&lfs, &file, *offset, LFS_SEEK_SET);
+        err = lfs_file_seek(&mount->lfs, &file, *offset, LFS_SEEK_SET);
         if (err < 0) return false;
-        err = lfs_file_read(&lfs, &file, buf, min(length - 1, file_size - *offset));
+        err = lfs_file_read(&mount->lfs, &file, buf, min(length - 1, file_size - *offset));
         if (err < 0) return false;
         for(int i = 0; i < length; i++) {
             (*offset)++;
@@ -183,20 +501,63 @@ bool filesystem_read_line(char *filename, char *buf, int32_t *offset, int32_t le
                 break;
             }
         }
-        return lfs_file_close(&lfs, &file) == LFS_ERR_OK;
+        return lfs_file_close(&mount->lfs, &file) == LFS_ERR_OK;
     }
 
     return false;
 }
 
+bool filesystem_line_reader_open(filesystem_line_reader_t *reader, char *filename) {
+    reader->pos = 0;
+    reader->len = 0;
+    reader->eof = false;
+    const char *path;
+    filesystem_mount_t *mount = _filesystem_resolve(filename, &path);
+    if (!mount) return false;
+    reader->lfs = &mount->lfs;
+    return lfs_file_open(reader->lfs, &reader->file, path, LFS_O_RDONLY) == LFS_ERR_OK;
+}
+
+bool filesystem_line_reader_next(filesystem_line_reader_t *reader, char *buf, int32_t length) {
+    int32_t i = 0;
+    bool found_any = false;
+
+    while (true) {
+        if (reader->pos == reader->len) {
+            if (reader->eof) break;
+            lfs_ssize_t read = lfs_file_read(reader->lfs, &reader->file, reader->buf, sizeof(reader->buf));
+            if (read < 0) {
+                reader->eof = true;
+                break;
+            }
+            if (read < (lfs_ssize_t)sizeof(reader->buf)) reader->eof = true;
+            reader->pos = 0;
+            reader->len = read;
+            continue;
+        }
+
+        found_any = true;
+        char c = reader->buf[reader->pos++];
+        if (c == '\n') break;
+        // anything past length is dropped, but we still have to find the end of the line.
+        if (i < length) buf[i++] = c;
+    }
+
+    buf[i] = 0;
+    return found_any;
+}
+
+void filesystem_line_reader_close(filesystem_line_reader_t *reader) {
+    lfs_file_close(reader->lfs, &reader->file);
+}
+
 static void filesystem_cat(char *filename) {
-    info.type = 0;
-    lfs_stat(&lfs, filename, &info);
-    if (filesystem_file_exists(filename)) {
-        if (info.size > 0) {
-            char *buf = malloc(info.size + 1);
-            filesystem_read_file(filename, buf, info.size);
-            buf[info.size] = '\0';
+    int32_t size = filesystem_get_file_size(filename);
+    if (size >= 0) {
+        if (size > 0) {
+            char *buf = malloc(size + 1);
+            filesystem_read_file(filename, buf, size);
+            buf[size] = '\0';
             printf("%s\r\n", buf);
             free(buf);
         } else {
@@ -208,26 +569,50 @@ static void filesystem_cat(char *filename) {
 }
 
 bool filesystem_write_file(char *filename, char *text, int32_t length) {
-    int err = lfs_file_open(&lfs, &file, filename, LFS_O_RDWR | LFS_O_CREAT | LFS_O_TRUNC);
+    const char *path;
+    filesystem_mount_t *mount = _filesystem_resolve(filename, &path);
+    if (!mount) return false;
+    _filesystem_will_change(filename);
+    int err = lfs_file_open(&mount->lfs, &file, path, LFS_O_RDWR | LFS_O_CREAT | LFS_O_TRUNC);
     if (err < 0) return false;
-    err = lfs_file_write(&lfs, &file, text, length);
+    err = lfs_file_write(&mount->lfs, &file, text, length);
     if (err < 0) return false;
-    return lfs_file_close(&lfs, &file) == LFS_ERR_OK;
+    return lfs_file_close(&mount->lfs, &file) == LFS_ERR_OK;
 }
 
 bool filesystem_append_file(char *filename, char *text, int32_t length) {
-    int err = lfs_file_open(&lfs, &file, filename, LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND);
+    const char *path;
+    filesystem_mount_t *mount = _filesystem_resolve(filename, &path);
+    if (!mount) return false;
+    _filesystem_will_change(filename);
+    int err = lfs_file_open(&mount->lfs, &file, path, LFS_O_WRONLY | LFS_O_CREAT | LFS_O_APPEND);
     if (err < 0) return false;
-    err = lfs_file_write(&lfs, &file, text, length);
+    err = lfs_file_write(&mount->lfs, &file, text, length);
     if (err < 0) return false;
-    return lfs_file_close(&lfs, &file) == LFS_ERR_OK;
+    return lfs_file_close(&mount->lfs, &file) == LFS_ERR_OK;
+}
+
+bool filesystem_mkdir(char *dirname) {
+    const char *path;
+    filesystem_mount_t *mount = _filesystem_resolve(dirname, &path);
+    if (!mount) return false;
+    _filesystem_will_change(dirname);
+    int err = lfs_mkdir(&mount->lfs, path);
+    if (err == LFS_ERR_EXIST) {
+        int32_t size;
+        return _filesystem_stat(dirname, &size) == LFS_TYPE_DIR;
+    }
+
+    return err == LFS_ERR_OK;
 }
 
 int filesystem_cmd_ls(int argc, char *argv[]) {
-    if (argc >= 2) {
-        filesystem_ls(&lfs, argv[1]);
+    const char *path;
+    filesystem_mount_t *mount = _filesystem_resolve(argc >= 2 ? argv[1] : "/", &path);
+    if (mount) {
+        filesystem_ls(&mount->lfs, path);
     } else {
-        filesystem_ls(&lfs, "/");
+        printf("ls: %s: Not mounted\r\n", argv[1]);
     }
     return 0;
 }
@@ -242,6 +627,9 @@ int filesystem_cmd_df(int argc, char *argv[]) {
     (void) argc;
     (void) argv;
     printf("free space: %ld bytes\r\n", filesystem_get_free_space());
+    if (external.mounted) {
+        printf("free space on %s: %ld bytes\r\n", FILESYSTEM_EXTERNAL_PREFIX, filesystem_get_external_free_space());
+    }
     return 0;
 }
 
@@ -262,7 +650,11 @@ int filesystem_cmd_echo(int argc, char *argv[]) {
         line[line_len] = '\0';
     }
 
-    if (strchr(argv[3], '/')) {
+    // files can go at the top of either filesystem.
+    const char *path;
+    filesystem_mount_t *mount = _filesystem_resolve(argv[3], &path);
+    if (mount != &internal) path++;
+    if (strchr(path, '/')) {
         printf("subdirectories are not supported\r\n");
         return -2;
     }
@@ -27,17 +27,61 @@
 #include <stdio.h>
 #include <stdbool.h>
 #include "watch.h"
+#include "lfs.h"
+
+/// Paths that start with this are on the external filesystem; see filesystem_mount_external.
+#define FILESYSTEM_EXTERNAL_PREFIX "/ext/"
 
 /** @brief Initializes and mounts the tiny 8kb filesystem, formatting it if need be.
   * @return true if the filesystem was mounted successfully.
   */
 bool filesystem_init(void);
 
+/** @brief Mounts a second filesystem on the SPI flash chip that sensor boards carry.
+  * @details Once this returns true, every function in this file works on the external filesystem for paths
+  *          that start with FILESYSTEM_EXTERNAL_PREFIX, e.g. "/ext/accel.csv", and on the internal one for
+  *          all other paths. This gives a face a megabyte to log to instead of the internal filesystem's few
+  *          kilobytes. It sets up the SPI bus, and fails if there's no flash chip on it.
+  *          By default the filesystem takes the second half of the chip, and accelerometer_data_acquisition_face's
+  *          log the first; define FILESYSTEM_EXTERNAL_FIRST_BLOCK and FILESYSTEM_EXTERNAL_BLOCK_COUNT to move it.
+  *          If there's no filesystem there yet, this formats one, but only if the whole range reads as erased.
+  *          Otherwise it fails, and leaves whatever is there alone; see filesystem_format_external.
+  * @return true if the filesystem was mounted successfully, or already was.
+  */
+bool filesystem_mount_external(void);
+
+/** @brief Formats the external filesystem's range of the SPI flash, whatever is in it, and mounts the result.
+  * @details Use this when filesystem_mount_external fails on a board that has a flash chip: its range holds a
+  *          damaged filesystem, or data from something else. Everything in the range is lost.
+  * @return true if the new filesystem was mounted successfully.
+  */
+bool filesystem_format_external(void);
+
+/** @brief Unmounts the external filesystem. This leaves the SPI bus as it is.
+  * @note Close any line reader on the external filesystem before you call this.
+  */
+void filesystem_unmount_external(void);
+
 /** @brief Gets the space available on the filesystem.
-  * @return the free space in bytes
+  * @details Counting the blocks in use means reading all of them, so the count is kept until the next write
+  *          or remove through this module. Calling this again before then costs nothing; so a face can check
+  *          it every time before it logs more data.
+  * @return the free space in bytes, or a negative littlefs error code
   */
 int32_t filesystem_get_free_space(void);
 
+/** @brief Gets the space in use on the filesystem, including its metadata.
+  * @details Like filesystem_get_free_space, this is cheap until the next write.
+  * @return the used space in bytes, or a negative littlefs error code
+  */
+int32_t filesystem_get_used_space(void);
+
+/** @brief Gets the space available on the external filesystem. Like filesystem_get_free_space, this is cheap until
+  *        the next write to it.
+  * @return the free space in bytes, or a negative littlefs error code, e.g. if the filesystem isn't mounted
+  */
+int32_t filesystem_get_external_free_space(void);
+
 /** @brief Checks for the existence of a file on the filesystem.
   * @param filename the file you wish to check
   * @return true if the file exists; false otherwise
@@ -77,9 +121,51 @@ bool filesystem_read_file(char *filename, char *buf, int32_t length);
   *               to reflect the offset of the next line.
   * @param length The maximum number of bytes to read
   * @return true if the read was successful; false otherwise
+  * @note This opens the file and seeks to offset every time. To read a file line by line, use
+  *       filesystem_line_reader_open instead.
   */
 bool filesystem_read_line(char *filename, char *buf, int32_t *offset, int32_t length);
 
+/// The size of the buffer a line reader reads the file into.
+#define FILESYSTEM_LINE_READER_BUFFER_SIZE 64
+
+/// @brief A file opened for reading one line at a time. Treat its contents as private.
+typedef struct {
+    lfs_t *lfs;
+    lfs_file_t file;
+    char buf[FILESYSTEM_LINE_READER_BUFFER_SIZE];
+    uint8_t pos;
+    uint8_t len;
+    bool eof;
+} filesystem_line_reader_t;
+
+/** @brief Opens a file for reading line by line.
+  * @details Use this instead of filesystem_read_line when you want to go through a whole file: that
+  *          function opens the file and seeks to the offset for every line, so reading a file of N lines
+  *          with it takes N opens and N seeks. A line reader opens the file once, reads it front to back
+  *          through a small buffer, and closes it when you are done.
+  * @param reader The reader to set up
+  * @param filename the file you wish to read
+  * @return true if the file was opened; false otherwise. If this returns true, you must call
+  *         filesystem_line_reader_close when you are done with it.
+  */
+bool filesystem_line_reader_open(filesystem_line_reader_t *reader, char *filename);
+
+/** @brief Reads the next line from a file opened with filesystem_line_reader_open.
+  * @param reader The reader
+  * @param buf A buffer of at least length + 1 bytes; the line will be read into this buffer without
+  *            its trailing newline, and terminated with a 0.
+  * @param length The maximum number of bytes to read. If the line is longer than this, the rest of it
+  *               is skipped, and the next call returns the line after it.
+  * @return true if a line was read; false at the end of the file, or if the read failed.
+  */
+bool filesystem_line_reader_next(filesystem_line_reader_t *reader, char *buf, int32_t length);
+
+/** @brief Closes a file opened with filesystem_line_reader_open.
+  * @param reader The reader
+  */
+void filesystem_line_reader_close(filesystem_line_reader_t *reader);
+
 /** @brief Writes file to the filesystem
   * @param filename the file you wish to write
   * @param text The contents of the file
@@ -96,6 +182,12 @@ bool filesystem_write_file(char *filename, char *text, int32_t length);
   */
 bool filesystem_append_file(char *filename, char *text, int32_t length);
 
+/** @brief Creates a directory on the filesystem.
+  * @param dirname the directory you wish to create. Its parent directory must already exist.
+  * @return true if the directory was created or already exists; false otherwise
+  */
+bool filesystem_mkdir(char *dirname);
+
 int filesystem_cmd_ls(int argc, char *argv[]);
 int filesystem_cmd_cat(int argc, char *argv[]);
 int filesystem_cmd_df(int argc, char *argv[]);
@@ -33,9 +33,13 @@
 #include "watch.h"
 #include "filesystem.h"
 #include "movement.h"
+#include "movement_event_queue.h"
 #include "shell.h"
 
-#ifndef MOVEMENT_FIRMWARE
+#if defined(MOVEMENT_CONFIG)
+// the host tests bring their own watch faces; see test/test_movement.c.
+#include MOVEMENT_CONFIG
+#elif !defined(MOVEMENT_FIRMWARE)
 #include "movement_config.h"
 #elif MOVEMENT_FIRMWARE == MOVEMENT_FIRMWARE_STANDARD
 #include "movement_config.h"
@@ -57,6 +61,11 @@
 
 #include "movement_custom_signal_tunes.h"
 
+// one round of alarm beeps is four beeps and four rests, then comes the repeat marker and the terminator.
+static int8_t alarm_tune[(8 + 1) * 2 + 1];
+// whether the signal or the alarm had to turn the buzzer on, and so should turn it off again when it's done.
+static bool sequence_enabled_buzzer;
+
 // Default to no secondary face behaviour.
 #ifndef MOVEMENT_SECONDARY_FACE_INDEX
 #define MOVEMENT_SECONDARY_FACE_INDEX 0
@@ -101,10 +110,40 @@
 
 movement_state_t movement_state;
 void * watch_face_contexts[MOVEMENT_NUM_FACES];
+// faces whose setup hasn't been called again since we woke from sleep mode.
+bool watch_face_needs_setup[MOVEMENT_NUM_FACES];
 watch_date_time scheduled_tasks[MOVEMENT_NUM_FACES];
+// indices into scheduled_tasks, sorted by deadline, so that the next task due is always scheduled_task_order[0].
+uint8_t scheduled_task_order[MOVEMENT_NUM_FACES];
+uint8_t num_scheduled_tasks = 0;
+
+typedef struct {
+    movement_subscription_t subscription;
+    uint8_t watch_face_index;
+    uint16_t next_minute;   // the minute of the day (0-1439) at which this subscription next fires
+} movement_subscription_entry_t;
+
+// recurring background task subscriptions, sorted by how soon they next fire after subscriptions_minute.
+movement_subscription_entry_t subscriptions[MOVEMENT_MAX_SUBSCRIPTIONS];
+uint8_t num_subscriptions = 0;
+
+typedef struct {
+    uint32_t loops;                 // calls to loop, other than background tasks
+    uint32_t activates;
+    uint32_t resigns;
+    uint32_t background_checks;     // calls to wants_background_task
+    uint32_t background_tasks;      // EVENT_BACKGROUND_TASK deliveries, however they were triggered
+    uint32_t stayed_awake;          // loop calls that returned false, keeping the watch out of standby
+    uint64_t cycles;                // time spent in all of the above. @see watch_get_cycle_count
+} movement_face_perf_t;
+
+// what each face has cost us since the last time the perf shell command printed it.
+movement_face_perf_t face_perf[MOVEMENT_NUM_FACES];
+// the minute of the day the subscription table was last brought up to date for, or -1 if it never was.
+int16_t subscriptions_minute = -1;
 const int32_t movement_le_inactivity_deadlines[8] = {INT_MAX, 600, 3600, 7200, 21600, 43200, 86400, 604800};
 const int16_t movement_timeout_inactivity_deadlines[4] = {60, 120, 300, 1800};
-movement_event_t event;
+movement_event_queue_t event_queue;
 
 const int16_t movement_timezone_offsets[] = {
     0,      //  0 :   0:00:00 (UTC)
@@ -157,8 +196,9 @@ void cb_mode_btn_interrupt(void);
 void cb_light_btn_interrupt(void);
 void cb_alarm_btn_interrupt(void);
 void cb_alarm_btn_extwake(void);
+void cb_accelerometer_fifo_interrupt(void);
 void cb_alarm_fired(void);
-void cb_fast_tick(void);
+void cb_timeout(void);
 void cb_tick(void);
 
 static inline void _movement_reset_inactivity_countdown(void) {
@@ -166,59 +206,288 @@ static inline void _movement_reset_inactivity_countdown(void) {
     movement_state.timeout_ticks = movement_timeout_inactivity_deadlines[movement_state.settings.bit.to_interval];
 }
 
-static inline void _movement_enable_fast_tick_if_needed(void) {
-    if (!movement_state.fast_tick_enabled) {
-        movement_state.fast_ticks = 0;
-        watch_rtc_register_periodic_callback(cb_fast_tick, 128);
-        movement_state.fast_tick_enabled = true;
+// sleep mode turns off the pins and peripherals that faces set up, so each face's setup runs again after waking.
+// rather than do that for every face at once, we do it just before a face next gets to run. in sleep mode itself,
+// faces keep running without it, as they always have.
+static bool _movement_face_loop(uint8_t watch_face_index, movement_event_t event) {
+    movement_face_perf_t *perf = &face_perf[watch_face_index];
+    uint32_t start = watch_get_cycle_count();
+    bool can_sleep = watch_faces[watch_face_index].loop(event, &movement_state.settings, watch_face_contexts[watch_face_index]);
+    perf->cycles += watch_get_cycles_since(start);
+
+    if (event.event_type == EVENT_BACKGROUND_TASK) {
+        perf->background_tasks++;
+    } else {
+        perf->loops++;
+        // in low energy mode, we go back to sleep no matter what the face says.
+        if (!can_sleep && movement_state.le_mode_ticks != -1) perf->stayed_awake++;
     }
+
+    return can_sleep;
 }
 
-static inline void _movement_disable_fast_tick_if_possible(void) {
-    if ((movement_state.light_ticks == -1) &&
-        (movement_state.alarm_ticks == -1) &&
-        ((movement_state.light_down_timestamp + movement_state.mode_down_timestamp + movement_state.alarm_down_timestamp) == 0)) {
-        movement_state.fast_tick_enabled = false;
-        watch_rtc_disable_periodic_callback(128);
+static void _movement_face_activate(uint8_t watch_face_index) {
+    uint32_t start = watch_get_cycle_count();
+    watch_faces[watch_face_index].activate(&movement_state.settings, watch_face_contexts[watch_face_index]);
+    face_perf[watch_face_index].cycles += watch_get_cycles_since(start);
+    face_perf[watch_face_index].activates++;
+}
+
+static void _movement_face_resign(uint8_t watch_face_index) {
+    uint32_t start = watch_get_cycle_count();
+    watch_faces[watch_face_index].resign(&movement_state.settings, watch_face_contexts[watch_face_index]);
+    face_perf[watch_face_index].cycles += watch_get_cycles_since(start);
+    face_perf[watch_face_index].resigns++;
+}
+
+static bool _movement_face_wants_background_task(uint8_t watch_face_index) {
+    if (watch_faces[watch_face_index].wants_background_task == NULL) return false;
+
+    uint32_t start = watch_get_cycle_count();
+    bool wants_background_task = watch_faces[watch_face_index].wants_background_task(&movement_state.settings, watch_face_contexts[watch_face_index]);
+    face_perf[watch_face_index].cycles += watch_get_cycles_since(start);
+    face_perf[watch_face_index].background_checks++;
+
+    return wants_background_task;
+}
+
+static inline void _movement_setup_face_if_needed(uint8_t watch_face_index) {
+    if (watch_face_needs_setup[watch_face_index] && movement_state.le_mode_ticks != -1) {
+        watch_face_needs_setup[watch_face_index] = false;
+        watch_faces[watch_face_index].setup(&movement_state.settings, watch_face_index, &watch_face_contexts[watch_face_index]);
+    }
+}
+
+static inline bool _movement_deadline_reached(movement_deadline_t deadline, uint32_t now) {
+    uint32_t timestamp = movement_state.deadlines[deadline];
+    return timestamp && (int32_t)(now - timestamp) >= 0;
+}
+
+static inline void _movement_set_deadline(movement_deadline_t deadline, uint32_t from, uint16_t ticks) {
+    uint32_t timestamp = from + ticks;
+    // zero means "not pending," so nudge a deadline that happens to land on it.
+    movement_state.deadlines[deadline] = timestamp ? timestamp : 1;
+}
+
+// arms the timeout for the soonest deadline that hasn't come due yet, or disables it if there isn't one.
+// deadlines that have come due but not been handled yet are app_loop's business; they don't need a timeout.
+static void _movement_arm_timeout(void) {
+    uint32_t now = watch_rtc_get_ticks();
+    int32_t soonest = INT32_MAX;
+
+    for(uint8_t i = 0; i < MOVEMENT_NUM_DEADLINES; i++) {
+        if (movement_state.deadlines[i] == 0) continue;
+        int32_t remaining = (int32_t)(movement_state.deadlines[i] - now);
+        if (remaining > 0 && remaining < soonest) soonest = remaining;
+    }
+
+    if (soonest == INT32_MAX) watch_rtc_disable_timeout_callback();
+    else watch_rtc_register_timeout_callback(cb_timeout, soonest > UINT16_MAX ? UINT16_MAX : soonest);
+}
+
+static void _movement_end_sequence(void) {
+    movement_state.is_buzzing = false;
+    movement_state.is_alarm_playing = false;
+    if (sequence_enabled_buzzer) watch_disable_buzzer();
+    sequence_enabled_buzzer = false;
+}
+
+// the signal and the alarm share the buzzer's sequencer, which plays one sequence at a time. if one of them is
+// already playing, the new one cuts it off and inherits its claim on the buzzer, so that whichever plays last turns
+// the buzzer off, and only if it was off to begin with.
+static void _movement_play_sequence(int8_t *sequence) {
+    if (movement_state.is_buzzing || movement_state.is_alarm_playing) {
+        // aborting doesn't call the old sequence's end callback, which is what we want: the buzzer stays on.
+        watch_buzzer_abort_sequence();
+        movement_state.is_buzzing = false;
+        movement_state.is_alarm_playing = false;
+    } else {
+        sequence_enabled_buzzer = !watch_is_buzzer_or_led_enabled();
+    }
+    watch_buzzer_play_sequence(sequence, _movement_end_sequence);
+}
+
+static inline void _movement_cancel_alarm(void) {
+    if (!movement_state.is_alarm_playing) return;
+    // aborting doesn't call the sequence's end callback, so we clean up after it ourselves.
+    watch_buzzer_abort_sequence();
+    _movement_end_sequence();
+}
+
+#define MINUTES_PER_DAY (24 * 60)
+
+static inline uint16_t _movement_minute_of_day(watch_date_time date_time) {
+    return date_time.unit.hour * 60 + date_time.unit.minute;
+}
+
+// the first minute of the day strictly after `after` that matches the subscription.
+static uint16_t _movement_subscription_next_minute(movement_subscription_t subscription, uint16_t after) {
+    uint16_t start_of_hour = after - after % 60;
+    uint16_t next;
+
+    switch (subscription.type) {
+        case MOVEMENT_SUBSCRIBE_AT_TIME:
+            return subscription.hour * 60 + subscription.minute;
+        case MOVEMENT_SUBSCRIBE_EVERY_N_MINUTES:
+            next = (after % 60) / subscription.minute * subscription.minute + subscription.minute;
+            if (next < 60) return start_of_hour + next;
+            // past the end of the hour; minute 0 of the next hour always matches.
+            // fall through
+        case MOVEMENT_SUBSCRIBE_TOP_OF_HOUR:
+        default:
+            return (start_of_hour + 60) % MINUTES_PER_DAY;
+    }
+}
+
+// how many minutes after subscriptions_minute the entry fires, from 1 to a whole day.
+static inline uint16_t _movement_subscription_sort_key(movement_subscription_entry_t *entry) {
+    return (entry->next_minute + MINUTES_PER_DAY - 1 - subscriptions_minute) % MINUTES_PER_DAY + 1;
+}
+
+static void _movement_insert_subscription(movement_subscription_entry_t entry) {
+    uint8_t i = num_subscriptions;
+    uint16_t key = _movement_subscription_sort_key(&entry);
+    while (i > 0 && _movement_subscription_sort_key(&subscriptions[i - 1]) > key) {
+        subscriptions[i] = subscriptions[i - 1];
+        i--;
+    }
+    subscriptions[i] = entry;
+    num_subscriptions++;
+}
+
+static void _movement_rebuild_subscriptions(uint16_t minute) {
+    // the clock was set, or we missed a minute somehow. work out every subscription's next firing from scratch.
+    uint8_t count = num_subscriptions;
+    movement_subscription_entry_t entries[MOVEMENT_MAX_SUBSCRIPTIONS];
+
+    memcpy(entries, subscriptions, sizeof(movement_subscription_entry_t) * count);
+    num_subscriptions = 0;
+    subscriptions_minute = minute;
+    for(uint8_t i = 0; i < count; i++) {
+        entries[i].next_minute = _movement_subscription_next_minute(entries[i].subscription, minute);
+        _movement_insert_subscription(entries[i]);
+    }
+}
+
+static void _movement_handle_subscriptions(watch_date_time date_time) {
+    uint16_t minute = _movement_minute_of_day(date_time);
+    movement_subscription_entry_t due[MOVEMENT_MAX_SUBSCRIPTIONS];
+    uint8_t num_due = 0;
+    uint8_t faces_to_call[MOVEMENT_MAX_SUBSCRIPTIONS];
+    uint8_t num_faces_to_call = 0;
+
+    if (num_subscriptions == 0 || minute == subscriptions_minute) return;
+    // normally we come through here once a minute; if not, catch up so that this minute's subscriptions still fire.
+    if (minute != (subscriptions_minute + 1) % MINUTES_PER_DAY) _movement_rebuild_subscriptions((minute + MINUTES_PER_DAY - 1) % MINUTES_PER_DAY);
+    subscriptions_minute = minute;
+
+    // the table is sorted, so we only ever have to look at the front of it. in an idle minute, that's all we do.
+    while (num_due < num_subscriptions && subscriptions[num_due].next_minute == minute) num_due++;
+    if (num_due == 0) return;
+
+    // take everything that's due off the front before putting any of it back, so that it sorts behind the rest.
+    memcpy(due, subscriptions, sizeof(movement_subscription_entry_t) * num_due);
+    num_subscriptions -= num_due;
+    memmove(&subscriptions[0], &subscriptions[num_due], sizeof(movement_subscription_entry_t) * num_subscriptions);
+    for(uint8_t i = 0; i < num_due; i++) {
+        bool already_calling = false;
+
+        due[i].next_minute = _movement_subscription_next_minute(due[i].subscription, minute);
+        _movement_insert_subscription(due[i]);
+
+        for(uint8_t j = 0; j < num_faces_to_call; j++) if (faces_to_call[j] == due[i].watch_face_index) already_calling = true;
+        if (!already_calling) faces_to_call[num_faces_to_call++] = due[i].watch_face_index;
+    }
+
+    // the table is consistent again, so it's safe for faces to subscribe and unsubscribe from their background task.
+    for(uint8_t i = 0; i < num_faces_to_call; i++) {
+        movement_event_t background_event = { EVENT_BACKGROUND_TASK, 0 };
+        _movement_setup_face_if_needed(faces_to_call[i]);
+        _movement_face_loop(faces_to_call[i], background_event);
     }
 }
 
 static void _movement_handle_background_tasks(void) {
+    _movement_handle_subscriptions(watch_rtc_get_date_time());
+
     for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
         // For each face, if the watch face wants a background task...
-        if (watch_faces[i].wants_background_task != NULL && watch_faces[i].wants_background_task(&movement_state.settings, watch_face_contexts[i])) {
+        if (_movement_face_wants_background_task(i)) {
             // ...we give it one. pretty straightforward!
             movement_event_t background_event = { EVENT_BACKGROUND_TASK, 0 };
-            watch_faces[i].loop(background_event, &movement_state.settings, watch_face_contexts[i]);
+            _movement_setup_face_if_needed(i);
+            _movement_face_loop(i, background_event);
         }
     }
     movement_state.needs_background_tasks_handled = false;
 }
 
+static void _movement_remove_scheduled_task(uint8_t watch_face_index) {
+    if (scheduled_tasks[watch_face_index].reg == 0) return;
+    scheduled_tasks[watch_face_index].reg = 0;
+    for(uint8_t i = 0; i < num_scheduled_tasks; i++) {
+        if (scheduled_task_order[i] == watch_face_index) {
+            memmove(&scheduled_task_order[i], &scheduled_task_order[i + 1], num_scheduled_tasks - i - 1);
+            num_scheduled_tasks--;
+            break;
+        }
+    }
+    movement_state.has_scheduled_background_task = num_scheduled_tasks > 0;
+}
+
+static void _movement_insert_scheduled_task(uint8_t watch_face_index, watch_date_time date_time) {
+    _movement_remove_scheduled_task(watch_face_index);
+    scheduled_tasks[watch_face_index].reg = date_time.reg;
+    // watch_date_time's bit fields run from year down to second, so comparing reg values compares the dates.
+    uint8_t i = num_scheduled_tasks;
+    while (i > 0 && scheduled_tasks[scheduled_task_order[i - 1]].reg > date_time.reg) {
+        scheduled_task_order[i] = scheduled_task_order[i - 1];
+        i--;
+    }
+    scheduled_task_order[i] = watch_face_index;
+    num_scheduled_tasks++;
+    movement_state.has_scheduled_background_task = true;
+}
+
+static void _movement_arm_alarm(void) {
+    // Movement has the one RTC alarm to itself. Normally it's set for the top of every minute (for background
+    // tasks and low power updates), but if a scheduled task comes due before then, we set it for that instead;
+    // handling the task re-arms it for the top of the minute. Tasks due within the next second are left to the
+    // next wake, since the alarm can't match the second we're already in.
+    watch_date_time alarm_time;
+    if (num_scheduled_tasks) {
+        watch_date_time now = watch_rtc_get_date_time();
+        watch_date_time next = scheduled_tasks[scheduled_task_order[0]];
+        if ((next.reg >> 6) == (now.reg >> 6) && next.unit.second >= now.unit.second + 2) {
+            // after a match, the alarm fires at the next rising edge of CLK_RTC_CNT, so we match one second early.
+            alarm_time.reg = next.reg;
+            alarm_time.unit.second--;
+            watch_rtc_register_alarm_callback(cb_alarm_fired, alarm_time, ALARM_MATCH_HHMMSS);
+            return;
+        }
+    }
+    alarm_time.reg = 0;
+    alarm_time.unit.second = 59; // after a match, the alarm fires at the next rising edge of CLK_RTC_CNT, so 59 seconds lets us update at :00
+    watch_rtc_register_alarm_callback(cb_alarm_fired, alarm_time, ALARM_MATCH_SS);
+}
+
 static void _movement_handle_scheduled_tasks(void) {
     watch_date_time date_time = watch_rtc_get_date_time();
-    uint8_t num_active_tasks = 0;
 
-    for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
-        if (scheduled_tasks[i].reg) {
-            if (scheduled_tasks[i].reg == date_time.reg) {
-                scheduled_tasks[i].reg = 0;
-                movement_event_t background_event = { EVENT_BACKGROUND_TASK, 0 };
-                watch_faces[i].loop(background_event, &movement_state.settings, watch_face_contexts[i]);
-                // check if loop scheduled a new task
-                if (scheduled_tasks[i].reg) {
-                    num_active_tasks++;
-                }
-            } else {
-                num_active_tasks++;
-            }
-        }
+    // fire everything that is due, including anything whose deadline passed while we weren't looking.
+    while (num_scheduled_tasks && scheduled_tasks[scheduled_task_order[0]].reg <= date_time.reg) {
+        uint8_t i = scheduled_task_order[0];
+        _movement_remove_scheduled_task(i);
+        movement_event_t background_event = { EVENT_BACKGROUND_TASK, 0 };
+        // the face may schedule a new task from here; it has to be in the future, so this loop will end.
+        _movement_setup_face_if_needed(i);
+        _movement_face_loop(i, background_event);
+        movement_state.needs_alarm_armed = true;
     }
 
-    if (num_active_tasks == 0) {
-        movement_state.has_scheduled_background_task = false;
-    } else {
-        _movement_reset_inactivity_countdown();
+    if (movement_state.needs_alarm_armed) {
+        movement_state.needs_alarm_armed = false;
+        _movement_arm_alarm();
     }
 }
 
@@ -242,8 +511,9 @@ void movement_illuminate_led(void) {
     if (movement_state.settings.bit.led_duration) {
         watch_set_led_color(movement_state.settings.bit.led_red_color ? (0xF | movement_state.settings.bit.led_red_color << 4) : 0,
                             movement_state.settings.bit.led_green_color ? (0xF | movement_state.settings.bit.led_green_color << 4) : 0);
-        movement_state.light_ticks = (movement_state.settings.bit.led_duration * 2 - 1) * 128;
-        _movement_enable_fast_tick_if_needed();
+        movement_state.light_on = true;
+        _movement_set_deadline(MOVEMENT_DEADLINE_LIGHT_OFF, watch_rtc_get_ticks(), (movement_state.settings.bit.led_duration * 2 - 1) * 128);
+        _movement_arm_timeout();
     }
 }
 
@@ -297,21 +567,72 @@ void movement_cancel_background_task(void) {
 void movement_schedule_background_task_for_face(uint8_t watch_face_index, watch_date_time date_time) {
     watch_date_time now = watch_rtc_get_date_time();
     if (date_time.reg > now.reg) {
-        movement_state.has_scheduled_background_task = true;
-        scheduled_tasks[watch_face_index].reg = date_time.reg;
+        _movement_insert_scheduled_task(watch_face_index, date_time);
+        _movement_arm_alarm();
     }
 }
 
 void movement_cancel_background_task_for_face(uint8_t watch_face_index) {
-    scheduled_tasks[watch_face_index].reg = 0;
-    bool other_tasks_scheduled = false;
-    for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
-        if (scheduled_tasks[i].reg != 0) {
-            other_tasks_scheduled = true;
+    if (scheduled_tasks[watch_face_index].reg == 0) return;
+    _movement_remove_scheduled_task(watch_face_index);
+    _movement_arm_alarm();
+}
+
+bool movement_subscribe_background_task_for_face(uint8_t watch_face_index, movement_subscription_t subscription) {
+    switch (subscription.type) {
+        case MOVEMENT_SUBSCRIBE_TOP_OF_HOUR:
+            subscription.hour = subscription.minute = 0;
             break;
+        case MOVEMENT_SUBSCRIBE_AT_TIME:
+            if (subscription.hour > 23 || subscription.minute > 59) return false;
+            break;
+        case MOVEMENT_SUBSCRIBE_EVERY_N_MINUTES:
+            if (subscription.minute == 0 || subscription.minute > 60) return false;
+            subscription.hour = 0;
+            break;
+        default:
+            return false;
+    }
+
+    for(uint8_t i = 0; i < num_subscriptions; i++) {
+        if (subscriptions[i].watch_face_index == watch_face_index &&
+            subscriptions[i].subscription.type == subscription.type &&
+            subscriptions[i].subscription.hour == subscription.hour &&
+            subscriptions[i].subscription.minute == subscription.minute) return true;
+    }
+    if (num_subscriptions == MOVEMENT_MAX_SUBSCRIPTIONS) return false;
+
+    // count from the minute the table is up to date for, so the new entry sorts in with the others.
+    if (subscriptions_minute < 0) subscriptions_minute = _movement_minute_of_day(watch_rtc_get_date_time());
+    movement_subscription_entry_t entry = {
+        .subscription = subscription,
+        .watch_face_index = watch_face_index,
+        .next_minute = _movement_subscription_next_minute(subscription, subscriptions_minute),
+    };
+    _movement_insert_subscription(entry);
+
+    return true;
+}
+
+void movement_unsubscribe_background_task_for_face(uint8_t watch_face_index, movement_subscription_t subscription) {
+    for(uint8_t i = 0; i < num_subscriptions; i++) {
+        if (subscriptions[i].watch_face_index == watch_face_index &&
+            subscriptions[i].subscription.type == subscription.type &&
+            (subscription.type != MOVEMENT_SUBSCRIBE_AT_TIME || subscriptions[i].subscription.hour == subscription.hour) &&
+            (subscription.type == MOVEMENT_SUBSCRIBE_TOP_OF_HOUR || subscriptions[i].subscription.minute == subscription.minute)) {
+            memmove(&subscriptions[i], &subscriptions[i + 1], sizeof(movement_subscription_entry_t) * (num_subscriptions - i - 1));
+            num_subscriptions--;
+            return;
         }
     }
-    movement_state.has_scheduled_background_task = other_tasks_scheduled;
+}
+
+void movement_unsubscribe_all_background_tasks_for_face(uint8_t watch_face_index) {
+    uint8_t j = 0;
+    for(uint8_t i = 0; i < num_subscriptions; i++) {
+        if (subscriptions[i].watch_face_index != watch_face_index) subscriptions[j++] = subscriptions[i];
+    }
+    num_subscriptions = j;
 }
 
 void movement_request_wake() {
@@ -319,29 +640,22 @@ void movement_request_wake() {
     _movement_reset_inactivity_countdown();
 }
 
-static void end_buzzing() {
-    movement_state.is_buzzing = false;
+void movement_enable_accelerometer_fifo_interrupt(uint8_t pin) {
+    watch_register_interrupt_callback(pin, cb_accelerometer_fifo_interrupt, INTERRUPT_TRIGGER_RISING);
 }
 
-static void end_buzzing_and_disable_buzzer(void) {
-    end_buzzing();
-    watch_disable_buzzer();
+void movement_disable_accelerometer_fifo_interrupt(uint8_t pin) {
+    watch_register_interrupt_callback(pin, NULL, INTERRUPT_TRIGGER_NONE);
 }
 
 void movement_play_signal(void) {
-    void *maybe_disable_buzzer = end_buzzing_and_disable_buzzer;
-    if (watch_is_buzzer_or_led_enabled()) {
-        maybe_disable_buzzer = end_buzzing;
-    } else {
-        watch_enable_buzzer();
-    }
+    // an alarm due at the same time as the signal is the one the user asked for, so let it play out.
+    if (movement_state.is_alarm_playing) return;
+    _movement_play_sequence(signal_tune);
     movement_state.is_buzzing = true;
-    watch_buzzer_play_sequence(signal_tune, maybe_disable_buzzer);
     if (movement_state.le_mode_ticks == -1) {
-        // the watch is asleep. wake it up for "1" round through the main loop.
-        // the sleep_mode_app_loop will notice the is_buzzing and note that it
-        // only woke up to beep and then it will spinlock until the callback
-        // turns off the is_buzzing flag.
+        // the watch is asleep, and sleep mode turns the buzzer off. wake it up for "1" round through the main loop;
+        // app_loop won't go back to low energy mode until the end callback turns off the is_buzzing flag.
         movement_state.needs_wake = true;
         movement_state.le_mode_ticks = 1;
     }
@@ -356,9 +670,27 @@ void movement_play_alarm_beeps(uint8_t rounds, BuzzerNote alarm_note) {
     if (rounds > 20) rounds = 20;
     movement_request_wake();
     movement_state.alarm_note = alarm_note;
-    // our tone is 0.375 seconds of beep and 0.625 of silence, repeated as given.
-    movement_state.alarm_ticks = 128 * rounds - 75;
-    _movement_enable_fast_tick_if_needed();
+
+    // our tone is 0.375 seconds of beep and 0.625 of silence, repeated as given. the sequencer runs at 64 Hz,
+    // and holds each note for one tick longer than its duration.
+    int8_t round[] = {
+        alarm_note, 2, BUZZER_NOTE_REST, 2,
+        alarm_note, 2, BUZZER_NOTE_REST, 2,
+        alarm_note, 2, BUZZER_NOTE_REST, 2,
+        alarm_note, 4, BUZZER_NOTE_REST, 40,
+    };
+    uint8_t pos = sizeof(round);
+    memcpy(alarm_tune, round, sizeof(round));
+    if (rounds > 1) {
+        alarm_tune[pos++] = -8;
+        alarm_tune[pos++] = rounds - 1;
+    }
+    alarm_tune[pos] = 0;
+
+    // the sequencer plays this in the background, so we can go back to standby between beats, and a button
+    // press can stop it right away. if the signal or an earlier alarm is still playing, this one replaces it.
+    _movement_play_sequence(alarm_tune);
+    movement_state.is_alarm_playing = true;
 }
 
 uint8_t movement_claim_backup_register(void) {
@@ -366,6 +698,36 @@ uint8_t movement_claim_backup_register(void) {
     return movement_state.next_available_backup_register++;
 }
 
+int movement_cmd_perf(int argc, char *argv[]) {
+    (void) argc;
+    (void) argv;
+
+    printf("face\tloop\tact\tresign\twants\tbg\tawake\tkcycles\r\n");
+    for (uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
+        movement_face_perf_t *perf = &face_perf[i];
+        printf("%u\t%lu\t%lu\t%lu\t%lu\t%lu\t%lu\t%llu\r\n", i,
+               (unsigned long)perf->loops,
+               (unsigned long)perf->activates,
+               (unsigned long)perf->resigns,
+               (unsigned long)perf->background_checks,
+               (unsigned long)perf->background_tasks,
+               (unsigned long)perf->stayed_awake,
+               (unsigned long long)(perf->cycles / 1000));
+    }
+    memset(face_perf, 0, sizeof(face_perf));
+
+    return 0;
+}
+
+void *movement_claim_context(uint8_t watch_face_index, size_t size) {
+    const watch_face_context_t *context = &watch_faces[watch_face_index].context;
+    if (size <= context->size) return context->storage;
+    if (context->size == 0) return malloc(size);
+
+    printf("face %u: context is %u bytes, but MOVEMENT_CONTEXT reserved %u\r\n", watch_face_index, (unsigned)size, context->size);
+    return NULL;
+}
+
 void app_init(void) {
 #if defined(NO_FREQCORR)
     watch_rtc_freqcorr_write(0, 0);
@@ -384,8 +746,6 @@ void app_init(void) {
     movement_state.settings.bit.to_interval = MOVEMENT_DEFAULT_TIMEOUT_INTERVAL;
     movement_state.settings.bit.le_interval = MOVEMENT_DEFAULT_LOW_ENERGY_INTERVAL;
     movement_state.settings.bit.led_duration = MOVEMENT_DEFAULT_LED_DURATION;
-    movement_state.light_ticks = -1;
-    movement_state.alarm_ticks = -1;
     movement_state.next_available_backup_register = 4;
     _movement_reset_inactivity_countdown();
 
@@ -421,14 +781,11 @@ void app_setup(void) {
         for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
             watch_face_contexts[i] = NULL;
             scheduled_tasks[i].reg = 0;
-            is_first_launch = false;
         }
+        num_scheduled_tasks = 0;
 
         // set up the 1 minute alarm (for background tasks and low power updates)
-        watch_date_time alarm_time;
-        alarm_time.reg = 0;
-        alarm_time.unit.second = 59; // after a match, the alarm fires at the next rising edge of CLK_RTC_CNT, so 59 seconds lets us update at :00
-        watch_rtc_register_alarm_callback(cb_alarm_fired, alarm_time, ALARM_MATCH_SS);
+        _movement_arm_alarm();
     }
     if (movement_state.le_mode_ticks != -1) {
         watch_disable_extwake_interrupt(BTN_ALARM);
@@ -445,13 +802,18 @@ void app_setup(void) {
         movement_request_tick_frequency(1);
 
         for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
-            watch_faces[i].setup(&movement_state.settings, i, &watch_face_contexts[i]);
+            // at launch, every face gets set up, so that they all have their contexts and can schedule or subscribe
+            // to background tasks. after that, only the face on screen gets set up now; the rest wait until they run.
+            if (is_first_launch) watch_faces[i].setup(&movement_state.settings, i, &watch_face_contexts[i]);
+            else watch_face_needs_setup[i] = true;
         }
+        _movement_setup_face_if_needed(movement_state.current_face_idx);
 
-        watch_faces[movement_state.current_face_idx].activate(&movement_state.settings, watch_face_contexts[movement_state.current_face_idx]);
-        event.subsecond = 0;
-        event.event_type = EVENT_ACTIVATE;
+        _movement_face_activate(movement_state.current_face_idx);
+        movement_state.needs_activate = true;
     }
+
+    is_first_launch = false;
 }
 
 void app_prepare_for_standby(void) {
@@ -461,14 +823,15 @@ void app_wake_from_standby(void) {
 }
 
 static void _sleep_mode_app_loop(void) {
+    movement_event_t event = { EVENT_LOW_ENERGY_UPDATE, 0 };
     movement_state.needs_wake = false;
     // as long as le_mode_ticks is -1 (i.e. we are in low energy mode), we wake up here, update the screen, and go right back to sleep.
     while (movement_state.le_mode_ticks == -1) {
         // we also have to handle background tasks here in the mini-runloop
         if (movement_state.needs_background_tasks_handled) _movement_handle_background_tasks();
+        if (movement_state.has_scheduled_background_task || movement_state.needs_alarm_armed) _movement_handle_scheduled_tasks();
 
-        event.event_type = EVENT_LOW_ENERGY_UPDATE;
-        watch_faces[movement_state.current_face_idx].loop(event, &movement_state.settings, watch_face_contexts[movement_state.current_face_idx]);
+        _movement_face_loop(movement_state.current_face_idx, event);
 
         // if we need to wake immediately, do it!
         if (movement_state.needs_wake) return;
@@ -478,59 +841,53 @@ static void _sleep_mode_app_loop(void) {
 }
 
 bool app_loop(void) {
-    const watch_face_t *wf = &watch_faces[movement_state.current_face_idx];
-    bool woke_up_for_buzzer = false;
+    movement_event_t event;
     if (movement_state.watch_face_changed) {
         if (movement_state.settings.bit.button_should_sound) {
             // low note for nonzero case, high note for return to watch_face 0
             watch_buzzer_play_note(movement_state.next_face_idx ? BUZZER_NOTE_C7 : BUZZER_NOTE_C8, 50);
         }
-        wf->resign(&movement_state.settings, watch_face_contexts[movement_state.current_face_idx]);
+        _movement_face_resign(movement_state.current_face_idx);
         movement_state.current_face_idx = movement_state.next_face_idx;
-        // we have just updated the face idx, so we must recache the watch face pointer.
-        wf = &watch_faces[movement_state.current_face_idx];
         watch_clear_display();
         movement_request_tick_frequency(1);
-        wf->activate(&movement_state.settings, watch_face_contexts[movement_state.current_face_idx]);
-        event.subsecond = 0;
-        event.event_type = EVENT_ACTIVATE;
+        _movement_setup_face_if_needed(movement_state.current_face_idx);
+        _movement_face_activate(movement_state.current_face_idx);
+        movement_state.needs_activate = true;
         movement_state.watch_face_changed = false;
     }
 
     // if the LED should be off, turn it off
-    if (movement_state.light_ticks == 0) {
-        // unless the user is holding down the LIGHT button, in which case, give them more time.
-        if (watch_get_pin_level(BTN_LIGHT)) {
-            movement_state.light_ticks = 1;
-        } else {
+    if (_movement_deadline_reached(MOVEMENT_DEADLINE_LIGHT_OFF, watch_rtc_get_ticks())) {
+        movement_state.deadlines[MOVEMENT_DEADLINE_LIGHT_OFF] = 0;
+        // unless the user is holding down the LIGHT button, in which case, give them more time: releasing it sets
+        // the deadline again.
+        if (!watch_get_pin_level(BTN_LIGHT)) {
             watch_set_led_off();
-            movement_state.light_ticks = -1;
-            _movement_disable_fast_tick_if_possible();
+            movement_state.light_on = false;
         }
     }
 
     // handle background tasks, if the alarm handler told us we need to
     if (movement_state.needs_background_tasks_handled) _movement_handle_background_tasks();
 
-    // if we have a scheduled background task, handle that here:
-    if (event.event_type == EVENT_TICK && movement_state.has_scheduled_background_task) _movement_handle_scheduled_tasks();
+    // if we have a scheduled background task, handle that here. this is cheap unless something is due.
+    if (movement_state.has_scheduled_background_task || movement_state.needs_alarm_armed) _movement_handle_scheduled_tasks();
+    // as long as a task is scheduled, stay out of low energy mode and don't time out.
+    if (movement_state.has_scheduled_background_task) _movement_reset_inactivity_countdown();
 
-    // if we have timed out of our low energy mode countdown, enter low energy mode.
-    if (movement_state.le_mode_ticks == 0) {
+    // if we have timed out of our low energy mode countdown, enter low energy mode. sleep mode turns off the buzzer,
+    // so let the signal or the alarm finish first; the sequencer keeps playing while we're in standby.
+    if (movement_state.le_mode_ticks == 0 && !movement_state.is_buzzing && !movement_state.is_alarm_playing) {
         movement_state.le_mode_ticks = -1;
         watch_register_extwake_callback(BTN_ALARM, cb_alarm_btn_extwake, true);
-        event.event_type = EVENT_NONE;
-        event.subsecond = 0;
+        // anything still queued is stale by the time we wake up.
+        movement_event_queue_clear(&event_queue);
 
         // _sleep_mode_app_loop takes over at this point and loops until le_mode_ticks is reset by the extwake handler,
         // or wake is requested using the movement_request_wake function.
         _sleep_mode_app_loop();
-        // as soon as _sleep_mode_app_loop returns, we prepare to reactivate
-        // ourselves, but first, we check to see if we woke up for the buzzer:
-        if (movement_state.is_buzzing) {
-            woke_up_for_buzzer = true;
-        }
-        event.event_type = EVENT_ACTIVATE;
+        // as soon as _sleep_mode_app_loop returns, we prepare to reactivate ourselves.
         // this is a hack tho: waking from sleep mode, app_setup does get called, but it happens before we have reset our ticks.
         // need to figure out if there's a better heuristic for determining how we woke up.
         app_setup();
@@ -539,20 +896,26 @@ bool app_loop(void) {
     // default to being allowed to sleep by the face.
     bool can_sleep = true;
 
-    if (event.event_type) {
-        event.subsecond = movement_state.subsecond;
+    if (movement_state.needs_activate) {
+        movement_state.needs_activate = false;
+        event.event_type = EVENT_ACTIVATE;
+        event.subsecond = 0;
         // the first trip through the loop overrides the can_sleep state
-        can_sleep = wf->loop(event, &movement_state.settings, watch_face_contexts[movement_state.current_face_idx]);
-        event.event_type = EVENT_NONE;
+        can_sleep = _movement_face_loop(movement_state.current_face_idx, event);
+    }
+
+    // deliver everything the interrupt handlers queued up since the last pass, in order. any trip that says it
+    // cannot sleep wins. if the face asks to move to another face, stop there: the rest of the queue goes to the
+    // new face once it has been activated.
+    while (!movement_state.watch_face_changed && movement_event_queue_pop(&event_queue, &event)) {
+        can_sleep = _movement_face_loop(movement_state.current_face_idx, event) && can_sleep;
     }
 
     // if we have timed out of our timeout countdown, give the app a hint that they can resign.
     if (movement_state.timeout_ticks == 0) {
         movement_state.timeout_ticks = -1;
-        if (movement_state.settings.bit.to_always == false) {
-            // if "timeout always" is false, give the current watch face a chance to exit gracefully...
-            event.event_type = EVENT_TIMEOUT;
-        }
+        // if "timeout always" is false, give the current watch face a chance to exit gracefully...
+        event.event_type = movement_state.settings.bit.to_always ? EVENT_NONE : EVENT_TIMEOUT;
         event.subsecond = movement_state.subsecond;
         // if we run through the loop again to time out, we need to reconsider whether or not we can sleep.
         // if the first trip said true, but this trip said false, we need the false to override, thus
@@ -561,75 +924,50 @@ bool app_loop(void) {
         // first trip  | can sleep | cannot sleep | can sleep    | cannot sleep
         // second trip | can sleep | cannot sleep | cannot sleep | can sleep
         //          && | can sleep | cannot sleep | cannot sleep | cannot sleep
-        bool can_sleep2 = wf->loop(event, &movement_state.settings, watch_face_contexts[movement_state.current_face_idx]);
+        bool can_sleep2 = _movement_face_loop(movement_state.current_face_idx, event);
         can_sleep = can_sleep && can_sleep2;
-        event.event_type = EVENT_NONE;
         if (movement_state.settings.bit.to_always && movement_state.current_face_idx != 0) {
             // ...but if the user has "timeout always" set, give it the boot.
             movement_move_to_face(0);
         }
     }
 
-    // Now that we've handled all display update tasks, handle the alarm.
-    if (movement_state.alarm_ticks >= 0) {
-        uint8_t buzzer_phase = (movement_state.alarm_ticks + 80) % 128;
-        if(buzzer_phase == 127) {
-            // failsafe: buzzer could have been disabled in the meantime
-            if (!watch_is_buzzer_or_led_enabled()) watch_enable_buzzer();
-            // play 4 beeps plus pause
-            for(uint8_t i = 0; i < 4; i++) {
-                // TODO: This method of playing the buzzer blocks the UI while it's beeping.
-                // It might be better to time it with the fast tick.
-                watch_buzzer_play_note(movement_state.alarm_note, (i != 3) ? 50 : 75);
-                if (i != 3) watch_buzzer_play_note(BUZZER_NOTE_REST, 50);
-            }
-        }
-        if (movement_state.alarm_ticks == 0) {
-            movement_state.alarm_ticks = -1;
-            _movement_disable_fast_tick_if_possible();
-        }
-    }
-
     // if we are plugged into USB, handle the serial shell
     if (watch_is_usb_enabled()) {
         shell_task();
     }
 
-    event.subsecond = 0;
-
     // if the watch face changed, we can't sleep because we need to update the display.
     if (movement_state.watch_face_changed) can_sleep = false;
 
-    // if we woke up for the buzzer, stay awake until it's finished.
-    if (woke_up_for_buzzer) {
-        while(watch_is_buzzer_or_led_enabled());
-    }
+    // if an interrupt queued an event after we drained the queue, go around again rather than sit on it until the next one.
+    if (!movement_event_queue_is_empty(&event_queue)) can_sleep = false;
 
     // if the LED is on, we need to stay awake to keep the TCC running.
-    if (movement_state.light_ticks != -1) can_sleep = false;
+    if (movement_state.light_on) can_sleep = false;
 
     return can_sleep;
 }
 
-static movement_event_type_t _figure_out_button_event(bool pin_level, movement_event_type_t button_down_event_type, uint16_t *down_timestamp) {
+static movement_event_type_t _figure_out_button_event(bool pin_level, movement_event_type_t button_down_event_type, movement_deadline_t long_press_deadline) {
+    uint8_t long_press_bit = 1 << (long_press_deadline - MOVEMENT_DEADLINE_LIGHT_LONG_PRESS);
+
     // force alarm off if the user pressed a button.
-    if (movement_state.alarm_ticks) movement_state.alarm_ticks = 0;
+    _movement_cancel_alarm();
 
     if (pin_level) {
-        // handle rising edge
-        _movement_enable_fast_tick_if_needed();
-        *down_timestamp = movement_state.fast_ticks + 1;
+        // handle rising edge: note when this press becomes a long one, and wait for that instead of counting up to it.
+        movement_state.long_presses &= ~long_press_bit;
+        _movement_set_deadline(long_press_deadline, watch_rtc_get_ticks(), MOVEMENT_LONG_PRESS_TICKS);
+        _movement_arm_timeout();
         return button_down_event_type;
     } else {
-        // this line is hack but it handles the situation where the light button was held for more than 20 seconds.
-        // fast tick is disabled by then, and the LED would get stuck on since there's no one left decrementing light_ticks.
-        if (movement_state.light_ticks == 1) movement_state.light_ticks = 0;
-        // now that that's out of the way, handle falling edge
-        uint16_t diff = movement_state.fast_ticks - *down_timestamp;
-        *down_timestamp = 0;
-        _movement_disable_fast_tick_if_possible();
-        // any press over a half second is considered a long press. Fire the long-up event
-        if (diff > MOVEMENT_LONG_PRESS_TICKS) return button_down_event_type + 3;
+        // handle falling edge. if cb_timeout already fired the long press, fire the long-up event.
+        bool was_long_press = movement_state.long_presses & long_press_bit;
+        movement_state.long_presses &= ~long_press_bit;
+        movement_state.deadlines[long_press_deadline] = 0;
+        _movement_arm_timeout();
+        if (was_long_press) return button_down_event_type + 3;
         else return button_down_event_type + 1;
     }
 }
@@ -637,19 +975,23 @@ static movement_event_type_t _figure_out_button_event(bool pin_level, movement_e
 void cb_light_btn_interrupt(void) {
     bool pin_level = watch_get_pin_level(BTN_LIGHT);
     _movement_reset_inactivity_countdown();
-    event.event_type = _figure_out_button_event(pin_level, EVENT_LIGHT_BUTTON_DOWN, &movement_state.light_down_timestamp);
+    // if the LED timed out while the button was held, it stayed on; now it can go off.
+    if (!pin_level && movement_state.light_on && !movement_state.deadlines[MOVEMENT_DEADLINE_LIGHT_OFF]) {
+        _movement_set_deadline(MOVEMENT_DEADLINE_LIGHT_OFF, watch_rtc_get_ticks(), 1);
+    }
+    movement_event_queue_push(&event_queue, _figure_out_button_event(pin_level, EVENT_LIGHT_BUTTON_DOWN, MOVEMENT_DEADLINE_LIGHT_LONG_PRESS), movement_state.subsecond);
 }
 
 void cb_mode_btn_interrupt(void) {
     bool pin_level = watch_get_pin_level(BTN_MODE);
     _movement_reset_inactivity_countdown();
-    event.event_type = _figure_out_button_event(pin_level, EVENT_MODE_BUTTON_DOWN, &movement_state.mode_down_timestamp);
+    movement_event_queue_push(&event_queue, _figure_out_button_event(pin_level, EVENT_MODE_BUTTON_DOWN, MOVEMENT_DEADLINE_MODE_LONG_PRESS), movement_state.subsecond);
 }
 
 void cb_alarm_btn_interrupt(void) {
     bool pin_level = watch_get_pin_level(BTN_ALARM);
     _movement_reset_inactivity_countdown();
-    event.event_type = _figure_out_button_event(pin_level, EVENT_ALARM_BUTTON_DOWN, &movement_state.alarm_down_timestamp);
+    movement_event_queue_push(&event_queue, _figure_out_button_event(pin_level, EVENT_ALARM_BUTTON_DOWN, MOVEMENT_DEADLINE_ALARM_LONG_PRESS), movement_state.subsecond);
 }
 
 void cb_alarm_btn_extwake(void) {
@@ -657,36 +999,35 @@ void cb_alarm_btn_extwake(void) {
     _movement_reset_inactivity_countdown();
 }
 
+void cb_accelerometer_fifo_interrupt(void) {
+    movement_event_queue_push(&event_queue, EVENT_ACCELEROMETER_FIFO, movement_state.subsecond);
+}
+
 void cb_alarm_fired(void) {
-    movement_state.needs_background_tasks_handled = true;
-}
-
-void cb_fast_tick(void) {
-    movement_state.fast_ticks++;
-    if (movement_state.light_ticks > 0) movement_state.light_ticks--;
-    if (movement_state.alarm_ticks > 0) movement_state.alarm_ticks--;
-    // check timestamps and auto-fire the long-press events
-    // Notice: is it possible that two or more buttons have an identical timestamp? In this case
-    // only one of these buttons would receive the long press event. Don't bother for now...
-    if (movement_state.light_down_timestamp > 0)
-        if (movement_state.fast_ticks - movement_state.light_down_timestamp == MOVEMENT_LONG_PRESS_TICKS + 1)
-            event.event_type = EVENT_LIGHT_LONG_PRESS;
-    if (movement_state.mode_down_timestamp > 0)
-        if (movement_state.fast_ticks - movement_state.mode_down_timestamp == MOVEMENT_LONG_PRESS_TICKS + 1)
-            event.event_type = EVENT_MODE_LONG_PRESS;
-    if (movement_state.alarm_down_timestamp > 0)
-        if (movement_state.fast_ticks - movement_state.alarm_down_timestamp == MOVEMENT_LONG_PRESS_TICKS + 1)
-            event.event_type = EVENT_ALARM_LONG_PRESS;
-    // this is just a fail-safe; fast tick should be disabled as soon as the button is up, the LED times out, and/or the alarm finishes.
-    // but if for whatever reason it isn't, this forces the fast tick off after 20 seconds.
-    if (movement_state.fast_ticks >= 128 * 20) {
-        watch_rtc_disable_periodic_callback(128);
-        movement_state.fast_tick_enabled = false;
+    // the alarm is set either for the top of the minute, or for a scheduled task (or both, if it's due at :00).
+    if (watch_rtc_get_date_time().unit.second == 0) movement_state.needs_background_tasks_handled = true;
+    // either way, it needs to be set again for whatever comes next.
+    movement_state.needs_alarm_armed = true;
+}
+
+void cb_timeout(void) {
+    static const movement_event_type_t long_press_events[] = { EVENT_LIGHT_LONG_PRESS, EVENT_MODE_LONG_PRESS, EVENT_ALARM_LONG_PRESS };
+    uint32_t now = watch_rtc_get_ticks();
+
+    // fire the long-press events for any buttons that have been held long enough. if two buttons went down on the
+    // same tick, both long presses are queued, in light-mode-alarm order.
+    for(uint8_t i = 0; i < 3; i++) {
+        if (_movement_deadline_reached(MOVEMENT_DEADLINE_LIGHT_LONG_PRESS + i, now)) {
+            movement_state.deadlines[MOVEMENT_DEADLINE_LIGHT_LONG_PRESS + i] = 0;
+            movement_state.long_presses |= 1 << i;
+            movement_event_queue_push(&event_queue, long_press_events[i], movement_state.subsecond);
+        }
     }
+    // the LED and alarm deadlines are handled by app_loop, which runs as soon as this interrupt returns.
+    _movement_arm_timeout();
 }
 
 void cb_tick(void) {
-    event.event_type = EVENT_TICK;
     watch_date_time date_time = watch_rtc_get_date_time();
     if (date_time.unit.second != movement_state.last_second) {
         // TODO: can we consolidate these two ticks?
@@ -698,4 +1039,5 @@ void cb_tick(void) {
     } else {
         movement_state.subsecond++;
     }
+    movement_event_queue_push(&event_queue, EVENT_TICK, movement_state.subsecond);
 }
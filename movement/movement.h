@@ -120,6 +120,7 @@ typedef enum {
     EVENT_ALARM_BUTTON_UP,      // The alarm button was pressed for less than half a second, and released.
     EVENT_ALARM_LONG_PRESS,     // The alarm button was held for over half a second, but not yet released.
     EVENT_ALARM_LONG_UP,        // The alarm button was held for over half a second, and released.
+    EVENT_ACCELEROMETER_FIFO,   // The accelerometer's FIFO has filled to its threshold. See movement_enable_accelerometer_fifo_interrupt.
 } movement_event_type_t;
 
 typedef struct {
@@ -138,7 +139,9 @@ extern const char movement_valid_position_1_chars[];
   *          need to keep track of any state in your watch face. If your watch face requires any other setup,
   *          like configuring a pin mode or a peripheral, you may want to do that here too.
   *          This function will be called again after waking from sleep mode, since sleep mode disables all
-  *          of the device's pins and peripherals.
+  *          of the device's pins and peripherals. To keep waking up quick, this happens right away only for the
+  *          face on screen; any other face is set up again just before it is next activated or given a
+  *          background task.
   * @param settings A pointer to the global Movement settings. You can use this to inform how you present your
   *                 display to the user (i.e. taking into account whether they have silenced the buttons, or if
   *                 they prefer 12 or 24-hour mode). You can also change these settings if you like.
@@ -147,8 +150,8 @@ extern const char movement_valid_position_1_chars[];
   *                         it later; your watch face's index is set at launch and will not change.
   * @param context_ptr A pointer to a pointer; at first invocation, this value will be NULL, and you can set it
   *                    to any value you like. Subsequent invocations will pass in whatever value you previously
-  *                    set. You may want to check if this is NULL and if so, allocate some space to store any
-  *                    data required for your watch face.
+  *                    set. You may want to check if this is NULL and if so, claim the space you reserved for
+  *                    your watch face's data with movement_claim_context.
   *
   */
 typedef void (*watch_face_setup)(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
@@ -225,20 +228,74 @@ typedef void (*watch_face_resign)(movement_settings_t *settings, void *context);
   *           - If your background task involves an external pin or peripheral, request background tasks no more than once per hour.
   *           - If you need to enable a pin or a peripheral to perform your task, return it to its original state afterwards.
   *
+  *          If your background task runs on a fixed pattern (the top of the hour, a time of day, every few minutes),
+  *          consider movement_subscribe_background_task_for_face instead; Movement will then only call you in the
+  *          minutes that match, rather than every minute.
+  *
   * @param settings A pointer to the global Movement settings. @see watch_face_setup.
   * @param context A pointer to your application's context. @see watch_face_setup.
   * @return true to request a background task; false otherwise.
   */
 typedef bool (*watch_face_wants_background_task)(movement_settings_t *settings, void *context);
 
+/// The kinds of recurring time patterns a watch face can subscribe to. @see movement_subscribe_background_task_for_face
+typedef enum {
+    MOVEMENT_SUBSCRIBE_NONE = 0,
+    MOVEMENT_SUBSCRIBE_TOP_OF_HOUR,         // Every hour, at minute 0.
+    MOVEMENT_SUBSCRIBE_AT_TIME,             // Every day at hour:minute.
+    MOVEMENT_SUBSCRIBE_EVERY_N_MINUTES,     // Every minute that is a multiple of minute (i.e. 15 fires at :00, :15, :30 and :45).
+} movement_subscription_type_t;
+
+typedef struct {
+    uint8_t type;       // a movement_subscription_type_t
+    uint8_t hour;       // for MOVEMENT_SUBSCRIBE_AT_TIME, the hour (0-23)
+    uint8_t minute;     // for MOVEMENT_SUBSCRIBE_AT_TIME, the minute; for MOVEMENT_SUBSCRIBE_EVERY_N_MINUTES, N (1-60)
+} movement_subscription_t;
+
+// The most subscriptions that can be active at once, across all watch faces.
+#ifndef MOVEMENT_MAX_SUBSCRIPTIONS
+#define MOVEMENT_MAX_SUBSCRIPTIONS 16
+#endif
+
+/// Storage for a watch face's context, reserved when the firmware is built. @see MOVEMENT_CONTEXT
+typedef struct {
+    void *storage;
+    uint16_t size;
+} watch_face_context_t;
+
+/** @brief Reserves storage for a watch face's context; use it as the last entry in your watch_face_t.
+  * @details The storage is a zeroed, statically allocated array big enough for one value of the given type.
+  *          It only exists for the faces that are listed in movement_config.h, so the linker adds up the
+  *          contexts of the configured faces along with the rest of RAM, and a firmware whose faces won't fit
+  *          fails to link instead of running out of heap on the wrist. A type too big for the size field fails
+  *          to compile.
+  */
+#define MOVEMENT_CONTEXT(type) { \
+    (uint64_t[(sizeof(type) + sizeof(uint64_t) - 1) / sizeof(uint64_t)]){0}, \
+    sizeof(type) + 0 * sizeof(struct { _Static_assert(sizeof(type) <= UINT16_MAX, "context too big for MOVEMENT_CONTEXT"); char c; }) \
+}
+
+/// For watch faces that don't keep a context. @see MOVEMENT_CONTEXT
+#define MOVEMENT_NO_CONTEXT { NULL, 0 }
+
 typedef struct {
     watch_face_setup setup;
     watch_face_activate activate;
     watch_face_loop loop;
     watch_face_resign resign;
     watch_face_wants_background_task wants_background_task;
+    watch_face_context_t context;
 } watch_face_t;
 
+// things Movement needs to do at a particular sub-second moment.
+typedef enum {
+    MOVEMENT_DEADLINE_LIGHT_LONG_PRESS = 0,     // the light button, if still held, becomes a long press.
+    MOVEMENT_DEADLINE_MODE_LONG_PRESS,          // the mode button, if still held, becomes a long press.
+    MOVEMENT_DEADLINE_ALARM_LONG_PRESS,         // the alarm button, if still held, becomes a long press.
+    MOVEMENT_DEADLINE_LIGHT_OFF,                // the LED turns off (or once the light button is released).
+    MOVEMENT_NUM_DEADLINES
+} movement_deadline_t;
+
 typedef struct {
     // properties stored in BACKUP register
     movement_settings_t settings;
@@ -247,25 +304,26 @@ typedef struct {
     int16_t current_face_idx;
     int16_t next_face_idx;
     bool watch_face_changed;
-    bool fast_tick_enabled;
-    int16_t fast_ticks;
+    bool needs_activate;
+
+    // sub-second deadlines, in watch_rtc_get_ticks ticks (0 if not pending). one timeout is armed for the soonest.
+    uint32_t deadlines[MOVEMENT_NUM_DEADLINES];
 
     // LED stuff
-    int16_t light_ticks;
+    bool light_on;
 
     // alarm stuff
-    int16_t alarm_ticks;
+    bool is_alarm_playing;
     bool is_buzzing;
     BuzzerNote alarm_note;
 
-    // button tracking for long press
-    uint16_t light_down_timestamp;
-    uint16_t mode_down_timestamp;
-    uint16_t alarm_down_timestamp;
+    // button tracking for long press: bit 0, 1 or 2 is set once the light, mode or alarm button's long press fires.
+    uint8_t long_presses;
 
     // background task handling
     bool needs_background_tasks_handled;
     bool has_scheduled_background_task;
+    bool needs_alarm_armed;
     bool needs_wake;
 
     // low energy mode countdown
@@ -304,12 +362,67 @@ void movement_cancel_background_task(void);
 void movement_schedule_background_task_for_face(uint8_t watch_face_index, watch_date_time date_time);
 void movement_cancel_background_task_for_face(uint8_t watch_face_index);
 
+/** @brief Subscribes a watch face to a recurring background task.
+  * @details Each minute that matches the pattern, Movement calls the face's loop function with EVENT_BACKGROUND_TASK,
+  *          in active and low energy modes alike, just as it would if wants_background_task had returned true. In
+  *          the minutes that don't match, the face isn't called at all. A face can hold several subscriptions; if
+  *          two of them match the same minute, it gets one EVENT_BACKGROUND_TASK. Subscribing twice to the same
+  *          pattern is harmless, so it's fine to do this from your setup function.
+  *
+  *          For times that move from day to day (i.e. sunrise), resolve the time yourself and subscribe with
+  *          MOVEMENT_SUBSCRIBE_AT_TIME; when the task fires, unsubscribe and subscribe again with the next day's time.
+  * @param watch_face_index The index you were given in your setup function.
+  * @param subscription The time pattern to subscribe to.
+  * @return true if the subscription is active, false if the table is full or the pattern is invalid.
+  */
+bool movement_subscribe_background_task_for_face(uint8_t watch_face_index, movement_subscription_t subscription);
+
+/** @brief Removes one subscription. @see movement_subscribe_background_task_for_face
+  */
+void movement_unsubscribe_background_task_for_face(uint8_t watch_face_index, movement_subscription_t subscription);
+
+/** @brief Removes all of a watch face's subscriptions. @see movement_subscribe_background_task_for_face
+  */
+void movement_unsubscribe_all_background_tasks_for_face(uint8_t watch_face_index);
+
 void movement_request_wake(void);
 
+/** @brief Delivers an EVENT_ACCELEROMETER_FIFO to the watch face in the foreground on each rising edge of a pin
+  *        wired to the LIS2DW's INT1. Set up the accelerometer with lis2dw_configure_fifo_threshold_int1.
+  * @details The interrupt wakes the watch from STANDBY, so a face can sleep until there is a batch of samples
+  *          to read instead of polling the FIFO on every tick.
+  * @param pin The pin INT1 is wired to: A0, A1, A3 or A4.
+  */
+void movement_enable_accelerometer_fifo_interrupt(uint8_t pin);
+
+/** @brief Stops delivering EVENT_ACCELEROMETER_FIFO. @see movement_enable_accelerometer_fifo_interrupt
+  */
+void movement_disable_accelerometer_fifo_interrupt(uint8_t pin);
+
 void movement_play_signal(void);
 void movement_play_alarm(void);
 void movement_play_alarm_beeps(uint8_t rounds, BuzzerNote alarm_note);
 
 uint8_t movement_claim_backup_register(void);
 
+/** @brief Returns the storage a watch face reserved for its context with MOVEMENT_CONTEXT.
+  * @details Call this from your setup function when context_ptr is NULL, and set context_ptr to the result.
+  *          The storage is zeroed at boot. Faces that reserve nothing (MOVEMENT_NO_CONTEXT) get the size they
+  *          ask for from malloc instead, as before MOVEMENT_CONTEXT existed.
+  * @return The storage, or NULL if the face reserved some, but less than the size you ask for. That means
+  *         its MOVEMENT_CONTEXT entry names the wrong type, which is a bug to fix in the face, not something to
+  *         paper over with heap that the build never accounted for.
+  * @param watch_face_index The index of the watch face, as passed to its setup function.
+  * @param size The size of the context, i.e. sizeof(your_face_state_t).
+  */
+void *movement_claim_context(uint8_t watch_face_index, size_t size);
+
+/** @brief Shell command that prints, then resets, how much each watch face has cost since it last ran.
+  * @details For each face, by index: the number of calls to loop (not counting background tasks), activate,
+  *          resign and wants_background_task; the number of background tasks delivered; how many times loop
+  *          returned false, keeping the watch out of standby; and the time spent in all of those calls, in
+  *          thousands of watch_get_cycle_count units (core clock cycles on hardware).
+  */
+int movement_cmd_perf(int argc, char *argv[]);
+
 #endif // MOVEMENT_H_
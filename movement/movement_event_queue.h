@@ -0,0 +1,100 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 The Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef MOVEMENT_EVENT_QUEUE_H_
+#define MOVEMENT_EVENT_QUEUE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "movement.h"
+
+/* A small ring of events between Movement's interrupt callbacks and app_loop.
+ *
+ * The tick, fast tick and button callbacks all run in interrupt context at the same priority, so they never
+ * preempt one another; together they are the single producer. app_loop is the single consumer. Each side only
+ * ever writes its own index, which makes the queue safe without disabling interrupts: the producer publishes an
+ * event by storing the new head after the event itself, and the consumer frees a slot by storing the new tail
+ * after it has copied the event out.
+ *
+ * Events that arrive while the queue is full are dropped and counted, rather than overwriting older events.
+ */
+
+// Must be a power of two no larger than 128, since head and tail are free-running uint8_t's.
+#ifndef MOVEMENT_EVENT_QUEUE_SIZE
+#define MOVEMENT_EVENT_QUEUE_SIZE 16
+#endif
+
+typedef struct {
+    movement_event_t events[MOVEMENT_EVENT_QUEUE_SIZE];
+    uint8_t head;       // next slot to write; only written by the producer
+    uint8_t tail;       // next slot to read; only written by the consumer
+    uint16_t dropped;   // number of events that arrived while the queue was full; only written by the producer
+} movement_event_queue_t;
+
+/** @brief Adds an event to the queue. Call this from interrupt context only.
+  * @return true if the event was queued, false if the queue was full and the event was dropped.
+  */
+static inline bool movement_event_queue_push(movement_event_queue_t *queue, movement_event_type_t event_type, uint8_t subsecond) {
+    uint8_t head = queue->head;
+    uint8_t tail = __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE);
+
+    if ((uint8_t)(head - tail) >= MOVEMENT_EVENT_QUEUE_SIZE) {
+        queue->dropped++;
+        return false;
+    }
+
+    queue->events[head & (MOVEMENT_EVENT_QUEUE_SIZE - 1)].event_type = event_type;
+    queue->events[head & (MOVEMENT_EVENT_QUEUE_SIZE - 1)].subsecond = subsecond;
+    __atomic_store_n(&queue->head, (uint8_t)(head + 1), __ATOMIC_RELEASE);
+
+    return true;
+}
+
+/** @brief Removes the oldest event from the queue. Call this from app_loop only.
+  * @return true if an event was copied into event, false if the queue was empty.
+  */
+static inline bool movement_event_queue_pop(movement_event_queue_t *queue, movement_event_t *event) {
+    uint8_t tail = queue->tail;
+    uint8_t head = __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+
+    if (head == tail) return false;
+
+    *event = queue->events[tail & (MOVEMENT_EVENT_QUEUE_SIZE - 1)];
+    __atomic_store_n(&queue->tail, (uint8_t)(tail + 1), __ATOMIC_RELEASE);
+
+    return true;
+}
+
+/** @brief Discards every event currently in the queue. Call this from app_loop only.
+  */
+static inline void movement_event_queue_clear(movement_event_queue_t *queue) {
+    __atomic_store_n(&queue->tail, __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+}
+
+static inline bool movement_event_queue_is_empty(movement_event_queue_t *queue) {
+    return __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE) == queue->tail;
+}
+
+#endif // MOVEMENT_EVENT_QUEUE_H_
@@ -97,6 +97,8 @@
 #include "decimal_time_face.h"
 #include "wyoscan_face.h"
 #include "save_load_face.h"
+#include "place_face.h"
+#include "places_face.h"
 #include "day_night_percentage_face.h"
 #include "simple_coin_flip_face.h"
 #include "solstice_face.h"
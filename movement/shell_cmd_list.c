@@ -29,6 +29,7 @@
 #include <stdlib.h>
 
 #include "filesystem.h"
+#include "movement.h"
 #include "watch.h"
 
 static int help_cmd(int argc, char *argv[]);
@@ -92,6 +93,13 @@ shell_command_t g_shell_commands[] = {
         .max_args = 3,
         .cb = filesystem_cmd_echo,
     },
+    {
+        .name = "perf",
+        .help = "print and reset per-face call counts and cycles",
+        .min_args = 0,
+        .max_args = 0,
+        .cb = movement_cmd_perf,
+    },
     {
         .name = "stress",
         .help = "test CDC write; usage: stress [LEN] [DELAY_MS]",
@@ -150,7 +158,7 @@ static int stress_cmd(int argc, char *argv[]) {
         snprintf(&test_str[i], 2, "%u", (i+1)%10);
         printf("%u:\t%s\r\n", (i+1), test_str);
         if (delay > 0) {
-            delay_ms(delay);
+            watch_delay_ms(delay);
         }
     }
 
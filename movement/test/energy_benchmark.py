@@ -0,0 +1,186 @@
+# MIT License
+#
+# Copyright (c) 2026 The Sensor Watch contributors
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+# Power regression benchmark. Builds Movement for the host (see watch-library/host), then wears it for a
+# scripted day: once on each face in movement_config.h, and once for each alt_fw variant, touring its faces.
+# The host's energy model estimates the average current for each run, and we compare that to the figures in
+# energy_baseline.txt. If any run draws more than the baseline plus the threshold, we exit with an error.
+#
+#   cd movement/test
+#   make energy                                   # or: python3 energy_benchmark.py
+#   python3 energy_benchmark.py --update          # accept the current figures as the new baseline
+
+import os
+import re
+import sys
+import argparse
+import subprocess
+import tempfile
+
+
+TEST_DIR = os.path.dirname(os.path.abspath(__file__))
+MOVEMENT_DIR = os.path.dirname(TEST_DIR)
+MAKE_DIR = os.path.join(MOVEMENT_DIR, "make")
+BUILD_DIR = os.path.join(TEST_DIR, "build-host", "energy")
+BASELINE = os.path.join(TEST_DIR, "energy_baseline.txt")
+
+# Same list as make_alternate_fw.sh; the standard variant is movement_config.h.
+VARIANTS = ["backer", "alt_time", "deep_space_now", "focus", "the_athlete", "the_backpacker", "the_stargazer"]
+
+START = "2023-06-01T00:00:00"
+LENGTH = "1d"
+
+# A day with the watch: it has been in low energy mode all night, so wake it with the alarm button, go to the face
+# under test (or to each face in turn), poke at it for a minute, then leave it be. Check the time with the light
+# once more in the evening.
+MORNING = """\
+wait 8h
+press alarm
+wait 2s
+"""
+USE_FACE = """\
+wait 2s
+press alarm
+wait 5s
+press light
+wait 5s
+press alarm 2s
+wait 5s
+press alarm
+wait 60s
+"""
+EVENING = """\
+wait 10h
+press alarm
+wait 2s
+press light
+"""
+
+
+def parse_faces(config):
+    """Returns the number of faces in a Movement config header, and its MOVEMENT_SECONDARY_FACE_INDEX."""
+    with open(config) as f:
+        contents = f.read()
+    faces = re.search(r"watch_faces\[\]\s*=\s*\{(.*?)\};", contents, re.S).group(1)
+    faces = re.sub(r"//[^\n]*|/\*.*?\*/", "", faces, flags=re.S)
+    num_faces = len([face for face in faces.split(",") if face.strip()])
+
+    secondary = 0
+    match = re.search(r"^#define MOVEMENT_SECONDARY_FACE_INDEX\s+(.*?)\s*(//.*)?$", contents, re.M)
+    if match:
+        secondary = eval(match.group(1).replace("MOVEMENT_NUM_FACES", str(num_faces)))
+
+    return num_faces, secondary
+
+
+def navigate_to(index, secondary):
+    # faces from the secondary index on are only reachable with a long press of mode from the first face.
+    if secondary and index >= secondary:
+        return "press mode 2s\nwait 1s\n" + "press mode\nwait 1s\n" * (index - secondary)
+    return "press mode\nwait 1s\n" * index
+
+
+def tour(num_faces, secondary):
+    return "".join(USE_FACE + "press mode\nwait 1s\n" for _ in range(secondary or num_faces))
+
+
+def build(variant):
+    build_dir = os.path.join(BUILD_DIR, variant or "standard")
+    command = ["make", "HOST=1", "COLOR=GREEN", "BUILD=" + build_dir]
+    if variant:
+        command.append("FIRMWARE=" + variant.upper())
+    result = subprocess.run(command, cwd=MAKE_DIR, capture_output=True, text=True)
+    if result.returncode:
+        sys.exit(result.stdout + result.stderr)
+    return os.path.join(build_dir, "watch")
+
+
+def run(binary, script):
+    with tempfile.NamedTemporaryFile("w", suffix=".txt", delete=False) as f:
+        f.write(script)
+    try:
+        output = subprocess.run([binary, "-d", START, "-t", LENGTH, "-s", f.name],
+                                check=True, capture_output=True, text=True).stdout
+    finally:
+        os.unlink(f.name)
+    return float(re.search(r"estimated current:\s*([\d.]+) uA", output).group(1))
+
+
+def read_baseline():
+    baseline = {}
+    if os.path.exists(BASELINE):
+        with open(BASELINE) as f:
+            for line in f:
+                line = line.split("#")[0].split()
+                if len(line) == 2:
+                    baseline[line[0]] = float(line[1])
+    return baseline
+
+
+def write_baseline(results):
+    with open(BASELINE, "w") as f:
+        f.write("# Estimated average current in uA over a scripted day; see energy_benchmark.py.\n")
+        for name, current in results.items():
+            f.write("%-32s %.3f\n" % (name, current))
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Checks that Movement's estimated power draw hasn't gone up.")
+    parser.add_argument("--threshold", type=float, default=5.0, help="percent increase that counts as a regression (default 5)")
+    parser.add_argument("--update", action="store_true", help="write the results to energy_baseline.txt")
+    args = parser.parse_args()
+
+    results = {}
+    binary = build(None)
+    num_faces, secondary = parse_faces(os.path.join(MOVEMENT_DIR, "movement_config.h"))
+    for index in range(num_faces):
+        results["standard/face%d" % index] = run(binary, MORNING + navigate_to(index, secondary) + USE_FACE + EVENING)
+    for variant in VARIANTS:
+        num_faces, secondary = parse_faces(os.path.join(MOVEMENT_DIR, "alt_fw", variant + ".h"))
+        results[variant] = run(build(variant), MORNING + tour(num_faces, secondary) + EVENING)
+
+    if args.update:
+        write_baseline(results)
+        print("wrote %d results to %s" % (len(results), BASELINE))
+        return 0
+
+    baseline = read_baseline()
+    failed = False
+    for name, current in results.items():
+        expected = baseline.get(name)
+        if expected is None:
+            verdict = "new"
+        elif current > expected * (1 + args.threshold / 100):
+            verdict = "REGRESSED"
+            failed = True
+        else:
+            verdict = "ok"
+        print("%-32s %10.3f uA  (baseline %s)  %s" % (name, current, "%.3f" % expected if expected else "-", verdict))
+
+    if failed:
+        print("estimated current went up by more than %g%%" % args.threshold)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,182 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 The Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// The workload for storage_benchmark.py. Runs filesystem.c over the host backend's emulated RWW EEPROM (see
+// watch-library/host/watch/watch_storage.c) through a month of what watch faces do with it: totp_face_lfs
+// loading its URIs, save_load_face saving slots, tempchart_face saving its chart, and a face appending to a
+// log until the filesystem fills up. Then prints what that cost the EEPROM. Build it with FILESYSTEM_* defines
+// to try other littlefs settings; see filesystem.c.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "filesystem.h"
+#include "watch_storage.h"
+#include "watch_host.h"
+
+#define DAYS 30
+#define TEMPCHART_SAVES_PER_DAY 3
+#define LOG_APPENDS_PER_DAY 64
+#define LOG_RECORD_SIZE 16
+#define LOG_MIN_FREE_SPACE 1024
+#define TOTP_RECORDS 8
+#define SAVE_LOAD_SLOTS 4
+#define SAVEFILE_SIZE 41
+#define TEMPCHART_SIZE (24 * 70 + 2)
+
+typedef enum {
+    WORKLOAD_TOTP = 0,
+    WORKLOAD_SAVE_LOAD,
+    WORKLOAD_TEMPCHART,
+    WORKLOAD_LOG,
+    NUM_WORKLOADS
+} workload_t;
+
+static const char *workload_names[NUM_WORKLOADS] = { "totp", "save_load", "tempchart", "log" };
+static uint64_t workload_ns[NUM_WORKLOADS];
+static uint32_t errors = 0;
+
+static uint8_t tempchart[TEMPCHART_SIZE];
+static uint8_t slots[SAVE_LOAD_SLOTS][SAVEFILE_SIZE];
+
+// everything the emulated EEPROM does between start and stop is charged to the workload.
+static uint64_t started_at;
+static void start(void) {
+    started_at = watch_host_get_stats()->storage_busy_ns;
+}
+static void stop(workload_t workload) {
+    watch_storage_sync();
+    workload_ns[workload] += watch_host_get_stats()->storage_busy_ns - started_at;
+}
+
+static void write_totp_file(void) {
+    filesystem_write_file("totp_uris.txt", "", 0);
+    for (int i = 0; i < TOTP_RECORDS; i++) {
+        char line[64];
+        int32_t length = sprintf(line, "otpauth://totp/user%d?secret=JBSWY3DPEHPK3PXP&issuer=Ex\n", i);
+        filesystem_append_file("totp_uris.txt", line, length);
+    }
+}
+
+static void load_totp(void) {
+    filesystem_line_reader_t reader;
+    char line[256];
+    int lines = 0;
+    if (filesystem_line_reader_open(&reader, "totp_uris.txt")) {
+        while (filesystem_line_reader_next(&reader, line, 255) && strlen(line)) lines++;
+        filesystem_line_reader_close(&reader);
+    }
+    if (lines != TOTP_RECORDS) errors++;
+}
+
+static void save_slot(int day) {
+    char filename[23];
+    uint8_t index = day % SAVE_LOAD_SLOTS;
+    for (int i = 0; i < SAVEFILE_SIZE; i++) slots[index][i] = day + i;
+    sprintf(filename, "save_load_face_%d.bin", index);
+    if (!filesystem_write_file(filename, (char *)slots[index], SAVEFILE_SIZE)) errors++;
+}
+
+static void load_slots(void) {
+    for (uint8_t i = 0; i < SAVE_LOAD_SLOTS; i++) {
+        char filename[23];
+        uint8_t buf[SAVEFILE_SIZE];
+        sprintf(filename, "save_load_face_%d.bin", i);
+        if (filesystem_get_file_size(filename) != SAVEFILE_SIZE) continue;
+        filesystem_read_file(filename, (char *)buf, SAVEFILE_SIZE);
+        if (memcmp(buf, slots[i], SAVEFILE_SIZE)) errors++;
+    }
+}
+
+static void save_tempchart(uint32_t n) {
+    tempchart[n % (TEMPCHART_SIZE - 2)]++;
+    tempchart[TEMPCHART_SIZE - 2] = n & 0xFF;
+    if (!filesystem_write_file("tempchart.ini", (char *)tempchart, TEMPCHART_SIZE)) errors++;
+}
+
+static void load_tempchart(void) {
+    static uint8_t buf[TEMPCHART_SIZE];
+    if (filesystem_get_file_size("tempchart.ini") != TEMPCHART_SIZE) return;
+    filesystem_read_file("tempchart.ini", (char *)buf, TEMPCHART_SIZE);
+    if (memcmp(buf, tempchart, TEMPCHART_SIZE)) errors++;
+}
+
+static void append_log(uint32_t n) {
+    char record[LOG_RECORD_SIZE + 1];
+    // start over when the log takes up too much room, the way a face logging sensor data would.
+    if (filesystem_get_free_space() < LOG_MIN_FREE_SPACE) filesystem_rm("sensor.log");
+    sprintf(record, "%014u\n", n);
+    if (!filesystem_append_file("sensor.log", record, LOG_RECORD_SIZE)) errors++;
+}
+
+int main(void) {
+    watch_host_stats_t *stats = watch_host_get_stats();
+
+    // the first mount finds nothing there, and formats the EEPROM.
+    filesystem_init();
+
+    start();
+    write_totp_file();
+    stop(WORKLOAD_TOTP);
+
+    uint32_t tempchart_saves = 0;
+    uint32_t log_records = 0;
+    for (int day = 0; day < DAYS; day++) {
+        // the watch reboots now and then, and every face loads its files again.
+        start();
+        load_totp();
+        stop(WORKLOAD_TOTP);
+        start();
+        load_slots();
+        save_slot(day);
+        stop(WORKLOAD_SAVE_LOAD);
+        start();
+        load_tempchart();
+        for (int i = 0; i < TEMPCHART_SAVES_PER_DAY; i++) save_tempchart(tempchart_saves++);
+        stop(WORKLOAD_TEMPCHART);
+        start();
+        for (int i = 0; i < LOG_APPENDS_PER_DAY; i++) append_log(log_records++);
+        stop(WORKLOAD_LOG);
+    }
+
+    load_slots();
+    load_tempchart();
+
+    uint32_t max_row_erases = 0;
+    for (uint32_t row = 0; row < NVMCTRL_RWWEE_PAGES / 4; row++) {
+        uint32_t erases = watch_host_get_storage_row_erases(row);
+        if (erases > max_row_erases) max_row_erases = erases;
+    }
+
+    printf("busy_ms %.1f\n", stats->storage_busy_ns / 1e6);
+    for (int i = 0; i < NUM_WORKLOADS; i++) printf("%s_ms %.1f\n", workload_names[i], workload_ns[i] / 1e6);
+    printf("reads %llu\n", (unsigned long long)stats->storage_reads);
+    printf("bytes_read %llu\n", (unsigned long long)stats->storage_bytes_read);
+    printf("page_writes %llu\n", (unsigned long long)stats->storage_page_writes);
+    printf("row_erases %llu\n", (unsigned long long)stats->storage_row_erases);
+    printf("max_row_erases %u\n", max_row_erases);
+    printf("errors %u\n", errors);
+
+    return 0;
+}
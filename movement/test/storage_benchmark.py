@@ -0,0 +1,100 @@
+# MIT License
+#
+# Copyright (c) 2026 The Sensor Watch contributors
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+
+# littlefs tuning benchmark. Builds storage_benchmark.c once for each configuration below, runs it over the host
+# backend's emulated RWW EEPROM, and prints how long the EEPROM was busy (reads, plus waiting on page writes and
+# row erases at the datasheet's timings), how much it was written and erased, and how evenly the erases were
+# spread. The first configuration is what filesystem.c uses today.
+#
+#   cd movement/test
+#   make storage                                  # or: python3 storage_benchmark.py
+
+import os
+import re
+import sys
+import subprocess
+
+
+TEST_DIR = os.path.dirname(os.path.abspath(__file__))
+BUILD_DIR = os.path.join(TEST_DIR, "build-host", "storage")
+
+# read_size and cache_size have to divide the 256-byte row, and cache_size has to be a multiple of both read_size
+# and the 64-byte page. lookahead_size is in bytes of bitmap, and 32 rows only need 4 of them, but littlefs wants
+# a multiple of 8. block_cycles of -1 turns off wear leveling within littlefs' metadata.
+CONFIGS = [
+    ("current",         dict(READ_SIZE=16, CACHE_SIZE=64, LOOKAHEAD_SIZE=16, BLOCK_CYCLES=100)),
+    ("read 64",         dict(READ_SIZE=64, CACHE_SIZE=64, LOOKAHEAD_SIZE=16, BLOCK_CYCLES=100)),
+    ("read 4",          dict(READ_SIZE=4, CACHE_SIZE=64, LOOKAHEAD_SIZE=16, BLOCK_CYCLES=100)),
+    ("cache 128",       dict(READ_SIZE=16, CACHE_SIZE=128, LOOKAHEAD_SIZE=16, BLOCK_CYCLES=100)),
+    ("cache 256",       dict(READ_SIZE=16, CACHE_SIZE=256, LOOKAHEAD_SIZE=16, BLOCK_CYCLES=100)),
+    ("lookahead 8",     dict(READ_SIZE=16, CACHE_SIZE=64, LOOKAHEAD_SIZE=8, BLOCK_CYCLES=100)),
+    ("cycles 16",       dict(READ_SIZE=16, CACHE_SIZE=64, LOOKAHEAD_SIZE=16, BLOCK_CYCLES=16)),
+    ("cycles 500",      dict(READ_SIZE=16, CACHE_SIZE=64, LOOKAHEAD_SIZE=16, BLOCK_CYCLES=500)),
+    ("no wear leveling", dict(READ_SIZE=16, CACHE_SIZE=64, LOOKAHEAD_SIZE=16, BLOCK_CYCLES=-1)),
+]
+
+COLUMNS = [
+    ("busy_ms", "busy ms"),
+    ("totp_ms", "totp"),
+    ("save_load_ms", "save/load"),
+    ("tempchart_ms", "tempchart"),
+    ("log_ms", "log"),
+    ("reads", "reads"),
+    ("page_writes", "writes"),
+    ("row_erases", "erases"),
+    ("max_row_erases", "max/row"),
+    ("errors", "errors"),
+]
+
+
+def build(name, config):
+    build_dir = os.path.join(BUILD_DIR, re.sub(r"\W+", "_", name))
+    defines = " ".join("-DFILESYSTEM_%s=%d" % item for item in config.items())
+    command = ["make", "BUILD=" + build_dir, "FILESYSTEM_CONFIG=" + defines, os.path.join(build_dir, "storage_benchmark")]
+    result = subprocess.run(command, cwd=TEST_DIR, capture_output=True, text=True)
+    if result.returncode:
+        sys.exit(result.stdout + result.stderr)
+    return os.path.join(build_dir, "storage_benchmark")
+
+
+def run(binary):
+    output = subprocess.run([binary], check=True, capture_output=True, text=True).stdout
+    return dict((key, float(value)) for key, value in re.findall(r"^(\w+) ([\d.]+)$", output, re.M))
+
+
+def main():
+    print("%-18s" % "config" + "".join("%11s" % label for _, label in COLUMNS))
+    failed = False
+    for name, config in CONFIGS:
+        results = run(build(name, config))
+        print("%-18s" % name + "".join("%11g" % results[key] for key, _ in COLUMNS))
+        failed = failed or results["errors"] > 0
+
+    if failed:
+        print("some configurations lost or corrupted data")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
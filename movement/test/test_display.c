@@ -0,0 +1,257 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 The Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Checks the generated character tables in watch_private_display.c against the segment-by-segment renderer
+// they replaced, which is kept below as a reference: every printable character at every position, drawn over
+// random display contents, has to leave exactly the same segments on. Then times watch_display_string with
+// both, which is the figure to watch if you touch either the tables or the rendering code. Last, checks that
+// watch_display_commit holds off while a frame is open.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "watch_slcd.h"
+#include "watch_private_display.h"
+
+#define BENCHMARK_CALLS 1000000
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+// cheap deterministic PRNG so that runs are repeatable.
+static uint32_t rng_state = 0x2545F491;
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static uint32_t reference_data[3];
+
+// stands in for the platform code that writes Segment_Data out to the display.
+static uint32_t segment_writes = 0;
+void _watch_display_write_segments(void) {
+    segment_writes++;
+}
+
+static void reference_set_pixel(uint8_t com, uint8_t seg) {
+    reference_data[com] |= 1ul << seg;
+}
+
+static void reference_clear_pixel(uint8_t com, uint8_t seg) {
+    reference_data[com] &= ~(1ul << seg);
+}
+
+// watch_display_character as it was before the tables, drawing into reference_data.
+static void reference_display_character(uint8_t character, uint8_t position) {
+    if (position == 4 || position == 6) {
+        if (character == '7') character = '&';
+        else if (character == 'A') character = 'a';
+        else if (character == 'o') character = 'O';
+        else if (character == 'L') character = '!';
+        else if (character == 'M' || character == 'm' || character == 'N') character = 'n';
+        else if (character == 'c') character = 'C';
+        else if (character == 'J') character = 'j';
+        else if (character == 'v' || character == 'V' || character == 'U' || character == 'W' || character == 'w') character = 'u';
+    } else {
+        if (character == 'u') character = 'v';
+        else if (character == 'j') character = 'J';
+    }
+    if (position > 1) {
+        if (character == 'T') character = 't';
+    }
+    if (position == 1) {
+        if (character == 'a') character = 'A';
+        else if (character == 'o') character = 'O';
+        else if (character == 'i') character = 'l';
+        else if (character == 'n') character = 'N';
+        else if (character == 'r') character = 'R';
+        else if (character == 'd') character = 'D';
+        else if (character == 'v' || character == 'V' || character == 'u') character = 'U';
+        else if (character == 'b') character = 'B';
+        else if (character == 'c') character = 'C';
+    } else {
+        if (character == 'R') character = 'r';
+    }
+    if (position == 0) {
+        reference_clear_pixel(0, 15);
+    } else {
+        if (character == 'I') character = 'l';
+    }
+
+    uint64_t segmap = Segment_Map[position];
+    uint64_t segdata = Character_Set[character - 0x20];
+
+    for (int i = 0; i < 8; i++) {
+        uint8_t com = (segmap & 0xFF) >> 6;
+        if (com > 2) {
+            segmap = segmap >> 8;
+            segdata = segdata >> 1;
+            continue;
+        }
+        uint8_t seg = segmap & 0x3F;
+
+        if (segdata & 1)
+          reference_set_pixel(com, seg);
+        else
+          reference_clear_pixel(com, seg);
+
+        segmap = segmap >> 8;
+        segdata = segdata >> 1;
+    }
+
+    if (character == 'T' && position == 1) reference_set_pixel(1, 12);
+    else if (position == 0 && (character == 'B' || character == 'D' || character == '@')) reference_set_pixel(0, 15);
+    else if (position == 1 && (character == 'B' || character == 'D' || character == '@')) reference_set_pixel(0, 12);
+}
+
+static void reference_display_string(char *string, uint8_t position) {
+    size_t i = 0;
+    while(string[i] != 0) {
+        reference_display_character(string[i], position + i);
+        i++;
+        if (position + i >= Num_Chars) break;
+    }
+}
+
+static void randomize_display(void) {
+    for (uint8_t com = 0; com < 3; com++) Segment_Data[com] = reference_data[com] = next_random() & 0xFFFFFF;
+}
+
+static bool display_matches(void) {
+    return memcmp(Segment_Data, reference_data, sizeof(reference_data)) == 0;
+}
+
+static void test_characters(void) {
+    printf("every character at every position\n");
+    uint32_t mismatches = 0;
+
+    for (uint8_t position = 0; position < Num_Chars; position++) {
+        for (uint8_t character = 0x20; character < 0x7F; character++) {
+            for (int trial = 0; trial < 16; trial++) {
+                randomize_display();
+                watch_display_character(character, position);
+                reference_display_character(character, position);
+                if (!display_matches()) {
+                    if (!mismatches) printf("  '%c' at position %d: %06x %06x %06x, expected %06x %06x %06x\n", character, position,
+                                            Segment_Data[0], Segment_Data[1], Segment_Data[2], reference_data[0], reference_data[1], reference_data[2]);
+                    mismatches++;
+                }
+            }
+        }
+    }
+    CHECK(mismatches == 0);
+
+    // the lp_seconds variant only ever gets digits in positions 8 and 9.
+    for (uint8_t position = 8; position < Num_Chars; position++) {
+        for (char digit = '0'; digit <= '9'; digit++) {
+            randomize_display();
+            watch_display_character_lp_seconds(digit, position);
+            reference_display_character(digit, position);
+            CHECK(display_matches());
+        }
+    }
+}
+
+static void test_strings(void) {
+    printf("random strings at random positions\n");
+    uint32_t mismatches = 0;
+
+    for (int trial = 0; trial < 100000; trial++) {
+        char string[Num_Chars + 1];
+        uint8_t length = next_random() % (Num_Chars + 1);
+        for (uint8_t i = 0; i < length; i++) string[i] = 0x20 + next_random() % 0x5F;
+        string[length] = 0;
+        uint8_t position = next_random() % Num_Chars;
+
+        randomize_display();
+        watch_display_string(string, position);
+        reference_display_string(string, position);
+        if (!display_matches()) mismatches++;
+    }
+    CHECK(mismatches == 0);
+}
+
+static double time_calls(void (*display_string)(char *, uint8_t)) {
+    // what a clock face draws every second, give or take.
+    static char strings[][11] = { "SA 1012 34", "SA 1012 35", "SA 1012 36", "SA 1012 37" };
+    struct timespec start, end;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (uint32_t i = 0; i < BENCHMARK_CALLS; i++) display_string(strings[i % 4], 0);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    return ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec)) / BENCHMARK_CALLS;
+}
+
+static void benchmark(void) {
+    printf("watch_display_string with a full 10 character string\n");
+    double reference_ns = time_calls(reference_display_string);
+    double table_ns = time_calls(watch_display_string);
+    printf("  segment by segment: %7.1f ns per call\n", reference_ns);
+    printf("  tables:             %7.1f ns per call (%.1fx)\n", table_ns, reference_ns / table_ns);
+}
+
+static void test_frames(void) {
+    printf("commits inside and outside of frames\n");
+    segment_writes = 0;
+
+    watch_display_commit();
+    CHECK(segment_writes == 1);
+
+    watch_display_begin_frame();
+    watch_display_string("SA 1012 34", 0);
+    watch_display_commit();
+    CHECK(segment_writes == 1);
+
+    // nested frames, e.g. a face drawing with a helper that opens its own
+    watch_display_begin_frame();
+    watch_set_colon();
+    watch_display_commit_frame();
+    CHECK(segment_writes == 1);
+
+    watch_display_commit_frame();
+    CHECK(segment_writes == 2);
+
+    watch_display_commit();
+    CHECK(segment_writes == 3);
+}
+
+int main(void) {
+    test_characters();
+    test_strings();
+    benchmark();
+    test_frames();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+
+    printf("all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,191 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 The Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+// Stress test for the ISR-to-app_loop event queue in movement_event_queue.h.
+//
+// The first half replays bursts of interleaved ticks and button edges, the way they pile up when app_loop
+// is busy (playing a note, say) while interrupts keep firing. Each burst is fed both to the queue and to a
+// model of the single `movement_event_t event` Movement used to have, where every interrupt overwrote the
+// previous one. The second half hammers the queue from a real producer thread against a consumer that
+// drains it in batches, and checks that every event that was accepted came out exactly once, in order.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include "movement_event_queue.h"
+
+#define STRESS_EVENTS 2000000
+
+static movement_event_queue_t queue;
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+// cheap deterministic PRNG so that runs are repeatable.
+static uint32_t rng_state = 0x2545F491;
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// a plausible interrupt: mostly ticks, with button edges and long presses mixed in.
+static movement_event_type_t random_interrupt_event(void) {
+    static const movement_event_type_t button_events[] = {
+        EVENT_LIGHT_BUTTON_DOWN, EVENT_LIGHT_BUTTON_UP, EVENT_LIGHT_LONG_PRESS,
+        EVENT_MODE_BUTTON_DOWN, EVENT_MODE_BUTTON_UP, EVENT_MODE_LONG_PRESS,
+        EVENT_ALARM_BUTTON_DOWN, EVENT_ALARM_BUTTON_UP, EVENT_ALARM_LONG_PRESS,
+    };
+    uint32_t r = next_random() % 4;
+    if (r < 2) return EVENT_TICK;
+    return button_events[next_random() % (sizeof(button_events) / sizeof(button_events[0]))];
+}
+
+static void test_bursts(void) {
+    printf("bursts of interrupts between two passes through app_loop\n");
+    printf("  burst   events   lost (single event)   lost (queue)\n");
+
+    for (uint8_t burst = 1; burst <= 2 * MOVEMENT_EVENT_QUEUE_SIZE; burst *= 2) {
+        const uint32_t wakes = 10000;
+        uint32_t legacy_lost = 0;
+        uint32_t queue_lost = 0;
+        uint16_t dropped_before = queue.dropped;
+
+        for (uint32_t wake = 0; wake < wakes; wake++) {
+            movement_event_type_t sent[2 * MOVEMENT_EVENT_QUEUE_SIZE];
+            movement_event_t legacy_event = { EVENT_NONE, 0 };
+            movement_event_t event;
+            uint8_t received = 0;
+
+            // the interrupts fire...
+            for (uint8_t i = 0; i < burst; i++) {
+                sent[i] = random_interrupt_event();
+                legacy_event.event_type = sent[i];
+                movement_event_queue_push(&queue, sent[i], i);
+            }
+            // ...and then app_loop gets around to them.
+            if (legacy_event.event_type != EVENT_NONE) legacy_lost += burst - 1;
+            while (movement_event_queue_pop(&queue, &event)) {
+                CHECK(event.event_type == sent[event.subsecond]);
+                CHECK(event.subsecond == received);
+                received++;
+            }
+            queue_lost += burst - received;
+        }
+
+        printf("  %5d %8u %21u %14u\n", burst, wakes * burst, legacy_lost, queue_lost);
+        CHECK((uint16_t)queue_lost == (uint16_t)(queue.dropped - dropped_before));
+        if (burst <= MOVEMENT_EVENT_QUEUE_SIZE) CHECK(queue_lost == 0);
+        else CHECK(queue_lost == wakes * (burst - MOVEMENT_EVENT_QUEUE_SIZE));
+    }
+}
+
+// in the threaded test, the subsecond field carries the low byte of a sequence number, and the producer
+// keeps a record of which events it managed to queue.
+static bool accepted[STRESS_EVENTS];
+static movement_event_type_t sent_types[STRESS_EVENTS];
+static bool producer_finished = false;
+
+static void *producer(void *arg) {
+    (void) arg;
+    for (uint32_t i = 0; i < STRESS_EVENTS; i++) {
+        accepted[i] = movement_event_queue_push(&queue, sent_types[i], (uint8_t)i);
+        // leave an uneven gap between interrupts, as real ones would. on a single core machine, also give the
+        // consumer a chance to run now and then, the way app_loop gets to run between interrupts.
+        uint32_t gap = (i * 2654435761u) >> 24;
+        for (volatile uint32_t spin = 0; spin < gap; spin++);
+        if ((gap & 0x7) == 0) sched_yield();
+    }
+    __atomic_store_n(&producer_finished, true, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+static void test_threaded(void) {
+    pthread_t thread;
+    movement_event_t *received = malloc(sizeof(movement_event_t) * STRESS_EVENTS);
+    uint32_t num_received = 0;
+    uint32_t num_accepted = 0;
+    uint32_t wakes = 0;
+    uint32_t dropped = 0;
+
+    printf("producer thread vs. consumer draining in batches\n");
+    memset(&queue, 0, sizeof(queue));
+    for (uint32_t i = 0; i < STRESS_EVENTS; i++) sent_types[i] = random_interrupt_event();
+
+    pthread_create(&thread, NULL, producer, NULL);
+    // drain until the producer is done and the queue is empty. each pass that finds something is one wake of app_loop.
+    while (!__atomic_load_n(&producer_finished, __ATOMIC_ACQUIRE) || !movement_event_queue_is_empty(&queue)) {
+        bool got_any = false;
+        while (movement_event_queue_pop(&queue, &received[num_received])) {
+            num_received++;
+            got_any = true;
+        }
+        if (!got_any) continue;
+        wakes++;
+        // pretend the watch face took a while to handle that batch.
+        for (volatile uint32_t spin = 0, n = next_random() % 4096; spin < n; spin++);
+        sched_yield();
+    }
+    pthread_join(thread, NULL);
+
+    // every accepted event should have come out exactly once, in order, with nothing extra.
+    uint32_t next = 0;
+    for (uint32_t i = 0; i < STRESS_EVENTS; i++) {
+        if (!accepted[i]) {
+            dropped++;
+            continue;
+        }
+        num_accepted++;
+        if (next < num_received) {
+            if (received[next].event_type != sent_types[i] || received[next].subsecond != (uint8_t)i) {
+                CHECK(!"event out of order or corrupted");
+                break;
+            }
+        }
+        next++;
+    }
+    CHECK(num_accepted == num_received);
+    CHECK((uint16_t)dropped == queue.dropped);
+
+    printf("  %u events sent, %u delivered over %u wakes (%.1f per wake), %u dropped (%.2f%%)\n",
+           STRESS_EVENTS, num_received, wakes, wakes ? (double)num_received / wakes : 0.0,
+           dropped, 100.0 * dropped / STRESS_EVENTS);
+    free(received);
+}
+
+int main(void) {
+    test_bursts();
+    test_threaded();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,258 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 The Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Checks the line reader in filesystem.h against the files it has to cope with: a trailing newline or not,
+// blank lines, lines longer than the caller's buffer and lines that straddle its own buffer. Then reads a
+// 100-line totp_uris.txt both with filesystem_read_line, the way totp_face_lfs used to, and with a line reader,
+// and reports the time and the storage reads each takes. Last, checks that the stat cache never hands out stale
+// metadata, and counts the storage reads it saves, and does the same for the free space count. Storage here is
+// an array in RAM that counts reads.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "filesystem.h"
+#include "watch_storage.h"
+
+#define BENCHMARK_LINES 100
+#define BENCHMARK_RUNS 100
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+// stands in for the watch's RWW EEPROM.
+static uint8_t storage[NVMCTRL_ROW_SIZE * NVMCTRL_RWWEE_PAGES];
+static uint32_t storage_reads = 0;
+static uint32_t storage_bytes_read = 0;
+
+bool watch_storage_read(uint32_t row, uint32_t offset, uint8_t *buffer, uint32_t size) {
+    storage_reads++;
+    storage_bytes_read += size;
+    memcpy(buffer, storage + row * NVMCTRL_ROW_SIZE + offset, size);
+    return true;
+}
+
+bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, uint32_t size) {
+    memcpy(storage + row * NVMCTRL_ROW_SIZE + offset, buffer, size);
+    return true;
+}
+
+bool watch_storage_erase(uint32_t row) {
+    memset(storage + row * NVMCTRL_ROW_SIZE, 0xff, NVMCTRL_ROW_SIZE);
+    return true;
+}
+
+bool watch_storage_sync(void) {
+    return true;
+}
+
+// reads filename with a line reader and checks that it comes out as the given lines.
+static void check_lines(char *filename, int32_t length, const char **expected, int num_expected) {
+    filesystem_line_reader_t reader;
+    char line[256];
+    int n = 0;
+
+    CHECK(filesystem_line_reader_open(&reader, filename));
+    while (filesystem_line_reader_next(&reader, line, length)) {
+        CHECK(n < num_expected);
+        if (n < num_expected && strcmp(line, expected[n])) printf("  line %d: \"%s\", expected \"%s\"\n", n, line, expected[n]);
+        if (n < num_expected) CHECK(strcmp(line, expected[n]) == 0);
+        n++;
+    }
+    filesystem_line_reader_close(&reader);
+    CHECK(n == num_expected);
+}
+
+static void test_reader(void) {
+    printf("line reader edge cases\n");
+
+    filesystem_write_file("lines.txt", "one\ntwo\n\nfour\n", 14);
+    check_lines("lines.txt", 255, (const char *[]){ "one", "two", "", "four" }, 4);
+
+    filesystem_write_file("lines.txt", "one\ntwo", 7);
+    check_lines("lines.txt", 255, (const char *[]){ "one", "two" }, 2);
+
+    filesystem_write_file("lines.txt", "", 0);
+    check_lines("lines.txt", 255, NULL, 0);
+
+    filesystem_write_file("lines.txt", "abcdefghij\nxyz\n", 15);
+    check_lines("lines.txt", 4, (const char *[]){ "abcd", "xyz" }, 2);
+
+    // lines that are longer than the reader's buffer, and lines that end right at its edge.
+    char text[3 * FILESYSTEM_LINE_READER_BUFFER_SIZE + 8];
+    char first[2 * FILESYSTEM_LINE_READER_BUFFER_SIZE];
+    char second[FILESYSTEM_LINE_READER_BUFFER_SIZE];
+    memset(first, 'a', sizeof(first) - 1);
+    first[sizeof(first) - 1] = 0;
+    memset(second, 'b', sizeof(second) - 1);
+    second[sizeof(second) - 1] = 0;
+    int32_t length = sprintf(text, "%s\n%s\nc\n", first, second);
+    filesystem_write_file("lines.txt", text, length);
+    check_lines("lines.txt", 255, (const char *[]){ first, second, "c" }, 3);
+
+    filesystem_line_reader_t reader;
+    CHECK(!filesystem_line_reader_open(&reader, "missing.txt"));
+}
+
+static void write_totp_file(void) {
+    filesystem_write_file("totp_uris.txt", "", 0);
+    for (int i = 0; i < BENCHMARK_LINES; i++) {
+        char line[128];
+        int32_t length = sprintf(line, "otpauth://totp/user%d?secret=JBSWY3DPEHPK3PXP&issuer=Ex\n", i);
+        filesystem_append_file("totp_uris.txt", line, length);
+    }
+}
+
+static int read_with_read_line(void) {
+    char line[256];
+    int32_t offset = 0;
+    int lines = 0;
+    while (filesystem_read_line("totp_uris.txt", line, &offset, 255) && strlen(line)) lines++;
+    return lines;
+}
+
+static int read_with_line_reader(void) {
+    filesystem_line_reader_t reader;
+    char line[256];
+    int lines = 0;
+    if (!filesystem_line_reader_open(&reader, "totp_uris.txt")) return 0;
+    while (filesystem_line_reader_next(&reader, line, 255) && strlen(line)) lines++;
+    filesystem_line_reader_close(&reader);
+    return lines;
+}
+
+static void time_reads(const char *label, int (*read_lines)(void)) {
+    struct timespec start, end;
+    int lines = 0;
+
+    storage_reads = 0;
+    storage_bytes_read = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (int i = 0; i < BENCHMARK_RUNS; i++) lines = read_lines();
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    double us = ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec)) / 1e3 / BENCHMARK_RUNS;
+    printf("  %-20s %3d lines %9.1f us %7u storage reads %8u bytes\n", label, lines, us,
+           storage_reads / BENCHMARK_RUNS, storage_bytes_read / BENCHMARK_RUNS);
+    CHECK(lines == BENCHMARK_LINES);
+}
+
+static void benchmark(void) {
+    printf("reading a %d-line totp_uris.txt, per pass\n", BENCHMARK_LINES);
+    write_totp_file();
+    time_reads("filesystem_read_line", read_with_read_line);
+    time_reads("line reader", read_with_line_reader);
+}
+
+// what a face does when it's set up: check for its file, see how big it is, and read it.
+static void load_like_a_face(char *filename) {
+    char buf[64];
+    if (filesystem_file_exists(filename)) {
+        int32_t size = filesystem_get_file_size(filename);
+        filesystem_read_file(filename, buf, size < (int32_t)sizeof(buf) ? size : (int32_t)sizeof(buf));
+    }
+}
+
+static void test_stat_cache(void) {
+    printf("stat cache\n");
+
+    // every change through filesystem.c has to show up in the next lookup, however the path is spelled.
+    filesystem_rm("cached.txt");
+    CHECK(!filesystem_file_exists("cached.txt"));
+    CHECK(filesystem_get_file_size("cached.txt") == -1);
+    filesystem_write_file("cached.txt", "abc", 3);
+    CHECK(filesystem_file_exists("cached.txt"));
+    CHECK(filesystem_get_file_size("/cached.txt") == 3);
+    filesystem_append_file("/cached.txt", "defg", 4);
+    CHECK(filesystem_get_file_size("cached.txt") == 7);
+    filesystem_write_file("cached.txt", "x", 1);
+    CHECK(filesystem_get_file_size("/cached.txt") == 1);
+    CHECK(filesystem_rm("/cached.txt"));
+    CHECK(!filesystem_file_exists("cached.txt"));
+    CHECK(!filesystem_rm("cached.txt"));
+
+    // names too long for the cache go to littlefs every time, which makes them a handy baseline.
+    char *cached = "place.loc";
+    char *uncached = "a_name_too_long_for_the_cache.loc";
+    filesystem_write_file(cached, "0123456789", 10);
+    filesystem_write_file(uncached, "0123456789", 10);
+
+    printf("  exists, get size and read, 100 times\n");
+    char *names[] = { uncached, cached };
+    char *labels[] = { "without the cache", "with the cache" };
+    for (int i = 0; i < 2; i++) {
+        storage_reads = 0;
+        storage_bytes_read = 0;
+        for (int j = 0; j < 100; j++) load_like_a_face(names[i]);
+        printf("  %-20s %7u storage reads %8u bytes\n", labels[i], storage_reads, storage_bytes_read);
+    }
+}
+
+static void test_free_space(void) {
+    printf("free space\n");
+    int32_t total = NVMCTRL_ROW_SIZE * (NVMCTRL_RWWEE_PAGES / 4);
+
+    storage_reads = 0;
+    int32_t free_before = filesystem_get_free_space();
+    uint32_t first_reads = storage_reads;
+    CHECK(free_before > 0);
+    CHECK(free_before + filesystem_get_used_space() == total);
+
+    // nothing has changed, so these shouldn't touch storage at all.
+    storage_reads = 0;
+    for (int i = 0; i < 100; i++) CHECK(filesystem_get_free_space() == free_before);
+    printf("  first call %u storage reads, next 100 calls %u\n", first_reads, storage_reads);
+    CHECK(storage_reads == 0);
+
+    char data[4 * NVMCTRL_ROW_SIZE];
+    memset(data, 'x', sizeof(data));
+    filesystem_write_file("big.bin", data, sizeof(data));
+    int32_t free_after = filesystem_get_free_space();
+    CHECK(free_after < free_before);
+    CHECK(free_after + filesystem_get_used_space() == total);
+
+    filesystem_rm("big.bin");
+    CHECK(filesystem_get_free_space() > free_after);
+}
+
+int main(void) {
+    // a blank storage, so this formats it first.
+    memset(storage, 0xff, sizeof(storage));
+    CHECK(filesystem_init());
+
+    test_reader();
+    benchmark();
+    test_stat_cache();
+    test_free_space();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+
+    printf("all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,238 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 The Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Mounts the external filesystem on the host backend's emulated SPI NOR flash (see
+// watch-library/host/watch/watch_spi.c), next to the internal one on the emulated RWW EEPROM: paths under
+// FILESYSTEM_EXTERNAL_PREFIX have to end up on the flash and everything else on the EEPROM, with the same names
+// kept apart, and the files have to come back after a remount. The filesystem has to stay out of the half of the
+// flash that belongs to the accelerometer log, and mustn't format over data it doesn't recognize. Then reports
+// what logging to each costs.
+
+#include <stdio.h>
+#include <string.h>
+#include "filesystem.h"
+#include "spiflash.h"
+#include "watch_host.h"
+
+#define LOG_LINES 200
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+static void test_mount(void) {
+    printf("mounting both filesystems\n");
+    watch_host_stats_t *stats = watch_host_get_stats();
+
+    CHECK(filesystem_init());
+    // nothing under the prefix until the external filesystem is mounted.
+    CHECK(!filesystem_write_file("/ext/early.txt", "x", 1));
+    CHECK(!filesystem_file_exists("/ext/early.txt"));
+    CHECK(filesystem_get_external_free_space() < 0);
+
+    // the flash starts out blank, so this formats it, in the second half of the chip.
+    uint64_t programs = stats->spi_flash_page_programs;
+    CHECK(filesystem_mount_external());
+    CHECK(stats->spi_flash_page_programs > programs);
+    CHECK(filesystem_mount_external());
+    CHECK(filesystem_get_external_free_space() > filesystem_get_free_space());
+}
+
+// whether the first half of the flash, where accelerometer_data_acquisition_face keeps its log, is still blank.
+static bool log_half_is_erased(void) {
+    uint32_t flash_size;
+    uint8_t *flash = watch_host_get_spi_flash(&flash_size);
+    for(uint32_t i = 0; i < flash_size / 2; i++) if (flash[i] != 0xFF) return false;
+    return true;
+}
+
+static void test_paths(void) {
+    printf("keeping the two filesystems apart\n");
+    uint32_t storage_size;
+    uint8_t *storage = watch_host_get_storage(&storage_size);
+    static uint8_t before[NVMCTRL_ROW_SIZE * NVMCTRL_RWWEE_PAGES];
+    char buf[32];
+
+    CHECK(filesystem_write_file("log.txt", "internal", 8));
+    memcpy(before, storage, storage_size);
+
+    // nothing written under the prefix touches the internal filesystem.
+    CHECK(filesystem_write_file("/ext/log.txt", "external!", 9));
+    CHECK(filesystem_append_file(FILESYSTEM_EXTERNAL_PREFIX "log.txt", "\nmore", 5));
+    CHECK(filesystem_mkdir("/ext/data"));
+    CHECK(filesystem_write_file("/ext/data/1.csv", "1,2,3\n", 6));
+    CHECK(memcmp(before, storage, storage_size) == 0);
+
+    CHECK(filesystem_get_file_size("log.txt") == 8);
+    CHECK(filesystem_get_file_size("/ext/log.txt") == 14);
+    // like littlefs, we don't care about leading slashes.
+    CHECK(filesystem_get_file_size("ext/log.txt") == 14);
+    CHECK(filesystem_get_file_size("//ext/data/1.csv") == 6);
+    // but the prefix has to be a whole path component.
+    CHECK(!filesystem_file_exists("/extlog.txt"));
+    CHECK(!filesystem_file_exists("/ext"));
+
+    CHECK(filesystem_read_file("/ext/log.txt", buf, 14));
+    CHECK(memcmp(buf, "external!\nmore", 14) == 0);
+    CHECK(filesystem_read_file("log.txt", buf, 8));
+    CHECK(memcmp(buf, "internal", 8) == 0);
+
+    filesystem_line_reader_t reader;
+    CHECK(filesystem_line_reader_open(&reader, "/ext/log.txt"));
+    CHECK(filesystem_line_reader_next(&reader, buf, sizeof(buf) - 1) && !strcmp(buf, "external!"));
+    CHECK(filesystem_line_reader_next(&reader, buf, sizeof(buf) - 1) && !strcmp(buf, "more"));
+    CHECK(!filesystem_line_reader_next(&reader, buf, sizeof(buf) - 1));
+    filesystem_line_reader_close(&reader);
+
+    int32_t offset = 0;
+    CHECK(filesystem_read_line("/ext/data/1.csv", buf, &offset, sizeof(buf) - 1));
+    CHECK(!strcmp(buf, "1,2,3") && offset == 6);
+
+    // removing one doesn't remove the other.
+    CHECK(filesystem_rm("/ext/log.txt"));
+    CHECK(!filesystem_file_exists("/ext/log.txt"));
+    CHECK(filesystem_file_exists("log.txt"));
+    CHECK(filesystem_write_file("/ext/log.txt", "again", 5));
+}
+
+static void test_remount(void) {
+    printf("unmounting and mounting again\n");
+    int32_t free_space = filesystem_get_external_free_space();
+
+    filesystem_unmount_external();
+    CHECK(!filesystem_file_exists("/ext/log.txt"));
+    CHECK(!filesystem_append_file("/ext/log.txt", "lost", 4));
+    CHECK(filesystem_get_external_free_space() < 0);
+    CHECK(filesystem_file_exists("log.txt"));
+
+    CHECK(filesystem_mount_external());
+    CHECK(filesystem_get_file_size("/ext/log.txt") == 5);
+    CHECK(filesystem_get_file_size("/ext/data/1.csv") == 6);
+    CHECK(filesystem_get_external_free_space() == free_space);
+
+    // and what's on the flash counts against its space, not the internal filesystem's.
+    static char big[16384];
+    memset(big, 'x', sizeof(big));
+    int32_t internal_free_space = filesystem_get_free_space();
+    CHECK(filesystem_write_file("/ext/big.bin", big, sizeof(big)));
+    CHECK(filesystem_get_file_size("/ext/big.bin") == (int32_t)sizeof(big));
+    CHECK(filesystem_get_external_free_space() < free_space);
+    CHECK(filesystem_get_free_space() == internal_free_space);
+    CHECK(filesystem_rm("/ext/big.bin"));
+
+    // none of that went near the log's half of the flash.
+    CHECK(log_half_is_erased());
+}
+
+static void test_foreign_data(void) {
+    printf("finding something other than a filesystem on the flash\n");
+    watch_host_stats_t *stats = watch_host_get_stats();
+    uint32_t flash_size;
+    uint8_t *flash = watch_host_get_spi_flash(&flash_size);
+    uint8_t *range = flash + flash_size / 2;
+    int32_t free_space = filesystem_get_external_free_space();
+
+    // scribble over both superblocks, as a log that ran over into this half might.
+    filesystem_unmount_external();
+    memset(range, 0x5A, 64);
+    memset(range + SPI_FLASH_SECTOR_SIZE, 0x5A, 64);
+
+    // the range isn't blank, so it's left alone...
+    uint64_t programs = stats->spi_flash_page_programs;
+    uint64_t erases = stats->spi_flash_sector_erases;
+    CHECK(!filesystem_mount_external());
+    CHECK(stats->spi_flash_page_programs == programs);
+    CHECK(stats->spi_flash_sector_erases == erases);
+    CHECK(range[0] == 0x5A && range[SPI_FLASH_SECTOR_SIZE + 63] == 0x5A);
+    CHECK(!filesystem_file_exists("/ext/log.txt"));
+    CHECK(filesystem_get_external_free_space() < 0);
+
+    // ...until we ask for a new filesystem.
+    CHECK(filesystem_format_external());
+    CHECK(!filesystem_file_exists("/ext/log.txt"));
+    CHECK(filesystem_get_external_free_space() > free_space);
+    CHECK(filesystem_write_file("/ext/log.txt", "again", 5));
+    filesystem_unmount_external();
+    CHECK(filesystem_mount_external());
+    CHECK(filesystem_get_file_size("/ext/log.txt") == 5);
+    CHECK(log_half_is_erased());
+}
+
+typedef struct {
+    uint64_t time_ns;
+    uint64_t writes;
+    uint64_t erases;
+} cost_t;
+
+// appends LOG_LINES lines to filename, the way a logging face would, one line every so often.
+static cost_t log_lines(char *filename) {
+    watch_host_stats_t *stats = watch_host_get_stats();
+    uint64_t start_ns = watch_host_get_time_ns();
+    uint64_t page_writes = stats->storage_page_writes + stats->spi_flash_page_programs;
+    uint64_t erases = stats->storage_row_erases + stats->spi_flash_sector_erases;
+    char line[24];
+
+    for (int i = 0; i < LOG_LINES; i++) {
+        int length = sprintf(line, "%d,%d,%d\n", 1700000000 + i * 60, i % 17, -i % 5);
+        CHECK(filesystem_append_file(filename, line, length));
+    }
+
+    cost_t cost = {
+        watch_host_get_time_ns() - start_ns,
+        stats->storage_page_writes + stats->spi_flash_page_programs - page_writes,
+        stats->storage_row_erases + stats->spi_flash_sector_erases - erases,
+    };
+    return cost;
+}
+
+static void benchmark(void) {
+    printf("appending %d lines to a log\n", LOG_LINES);
+    int32_t internal_free_space = filesystem_get_free_space();
+    int32_t external_free_space = filesystem_get_external_free_space();
+    cost_t internal = log_lines("accel.csv");
+    cost_t external = log_lines("/ext/accel.csv");
+
+    printf("  internal: %7.1f ms, %5llu page writes, %4llu erases, %ld of %ld bytes free left\n",
+           internal.time_ns / 1e6, (unsigned long long)internal.writes, (unsigned long long)internal.erases,
+           (long)filesystem_get_free_space(), (long)internal_free_space);
+    printf("  external: %7.1f ms, %5llu page writes, %4llu erases, %ld of %ld bytes free left\n",
+           external.time_ns / 1e6, (unsigned long long)external.writes, (unsigned long long)external.erases,
+           (long)filesystem_get_external_free_space(), (long)external_free_space);
+}
+
+int main(void) {
+    test_mount();
+    test_paths();
+    test_remount();
+    test_foreign_data();
+    benchmark();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+
+    printf("all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,231 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 The Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Checks lis2dw_read_fifo against the sample-at-a-time read it replaced, which is kept below as a reference,
+// on a mock LIS2DW attached to the host backend's I2C bus: for FIFOs of every depth, both have to come back
+// with the same readings in the same order, and the same overrun flag. Then counts what a second of 25 Hz
+// logging costs on the bus each way, which is what accelerometer_data_acquisition_face does. Last, checks
+// that the FIFO threshold interrupt goes low once lis2dw_read_fifo has drained the FIFO, so that the face
+// sees a rising edge for every batch.
+
+#include <stdio.h>
+#include <string.h>
+#include "lis2dw.h"
+#include "watch_i2c.h"
+#include "watch_host.h"
+
+#define FIFO_DEPTH 32
+#define LOGGING_SECONDS 60
+#define SAMPLES_PER_SECOND 25
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+// cheap deterministic PRNG so that runs are repeatable.
+static uint32_t rng_state = 0x2545F491;
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+// Just enough of a LIS2DW for reading its FIFO: a register pointer that auto-increments, the FIFO_SAMPLE
+// register, and output registers that pop the oldest sample in the FIFO once OUT_Z_H has been read, then
+// roll back to OUT_X_L.
+static struct {
+    uint8_t pointer;
+    uint8_t registers[0x40];
+    lis2dw_reading_t fifo[FIFO_DEPTH];
+    uint8_t count;
+    bool overrun;
+} mock;
+
+static void mock_push(lis2dw_reading_t reading) {
+    if (mock.count == FIFO_DEPTH) {
+        mock.overrun = true;
+        return;
+    }
+    mock.fifo[mock.count++] = reading;
+}
+
+static uint8_t mock_read_register(void) {
+    uint8_t reg = mock.pointer;
+
+    if (reg >= LIS2DW_REG_OUT_X_L && reg < LIS2DW_REG_OUT_X_L + 6) {
+        uint16_t word = ((uint16_t *)&mock.fifo[0])[(reg - LIS2DW_REG_OUT_X_L) / 2];
+        uint8_t value = (reg & 1) ? word >> 8 : word & 0xFF;
+        if (reg == LIS2DW_REG_OUT_X_L + 5) {
+            if (mock.count) memmove(&mock.fifo[0], &mock.fifo[1], --mock.count * sizeof(lis2dw_reading_t));
+            mock.pointer = LIS2DW_REG_OUT_X_L;
+        } else {
+            mock.pointer++;
+        }
+        return value;
+    }
+
+    mock.pointer++;
+    if (reg == LIS2DW_REG_FIFO_SAMPLE) return mock.count | (mock.overrun ? LIS2DW_FIFO_SAMPLE_OVERRUN : 0);
+    return mock.registers[reg & 0x3F];
+}
+
+static void mock_write(void *context, const uint8_t *buf, uint16_t length) {
+    (void) context;
+    if (!length) return;
+    mock.pointer = buf[0] & 0x7F;
+    for (uint16_t i = 1; i < length; i++) mock.registers[mock.pointer++ & 0x3F] = buf[i];
+}
+
+static void mock_read(void *context, uint8_t *buf, uint16_t length) {
+    (void) context;
+    for (uint16_t i = 0; i < length; i++) buf[i] = mock_read_register();
+}
+
+// what INT1 would be showing, with the FIFO threshold routed to it.
+static bool mock_int1(void) {
+    uint8_t threshold = mock.registers[LIS2DW_REG_FIFO_CTRL] & LIS2DW_FIFO_CTRL_FTH;
+    return (mock.registers[LIS2DW_REG_CTRL4_INT1] & LIS2DW_CTRL4_INT1_FTH) && mock.count >= threshold;
+}
+
+static void mock_fill(uint8_t count, bool overrun) {
+    mock.count = 0;
+    mock.overrun = false;
+    for (uint8_t i = 0; i < count; i++) {
+        uint32_t r = next_random();
+        lis2dw_reading_t reading = { (int16_t)r, (int16_t)(r >> 16), (int16_t)next_random() };
+        mock_push(reading);
+    }
+    if (overrun) mock.overrun = true;
+}
+
+// lis2dw_read_fifo as it was before the burst read: one transaction pair per sample.
+static bool reference_read_fifo(lis2dw_fifo_t *fifo_data) {
+    uint8_t temp = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_FIFO_SAMPLE);
+    bool overrun = !!(temp & LIS2DW_FIFO_SAMPLE_OVERRUN);
+
+    fifo_data->count = temp & LIS2DW_FIFO_SAMPLE_COUNT;
+
+    for(int i = 0; i < fifo_data->count; i++) {
+        fifo_data->readings[i] = lis2dw_get_raw_reading();
+    }
+
+    return overrun;
+}
+
+static void test_fifo(void) {
+    printf("FIFOs of every depth, with and without overrun\n");
+    uint32_t mismatches = 0;
+
+    for (uint8_t count = 0; count <= FIFO_DEPTH; count++) {
+        for (int trial = 0; trial < 8; trial++) {
+            bool overrun = trial & 1;
+            uint32_t state = rng_state;
+            lis2dw_fifo_t expected, actual;
+            memset(&expected, 0, sizeof(expected));
+            memset(&actual, 0, sizeof(actual));
+
+            mock_fill(count, overrun);
+            bool expected_overrun = reference_read_fifo(&expected);
+            CHECK(mock.count == 0);
+
+            rng_state = state;
+            mock_fill(count, overrun);
+            bool actual_overrun = lis2dw_read_fifo(&actual);
+            CHECK(mock.count == 0);
+
+            CHECK(actual_overrun == expected_overrun);
+            CHECK(actual.count == count);
+            if (actual.count != expected.count ||
+                memcmp(actual.readings, expected.readings, count * sizeof(lis2dw_reading_t))) mismatches++;
+        }
+    }
+    CHECK(mismatches == 0);
+}
+
+static void log_for_a_while(bool (*read_fifo)(lis2dw_fifo_t *)) {
+    lis2dw_fifo_t fifo;
+    for (int second = 0; second < LOGGING_SECONDS; second++) {
+        mock_fill(SAMPLES_PER_SECOND, false);
+        read_fifo(&fifo);
+    }
+}
+
+static void benchmark(void) {
+    printf("%d seconds of logging at %d Hz, reading the FIFO once a second\n", LOGGING_SECONDS, SAMPLES_PER_SECOND);
+    watch_host_stats_t *stats = watch_host_get_stats();
+    uint64_t transactions[2], bytes[2], busy_ns[2];
+
+    for (int i = 0; i < 2; i++) {
+        uint64_t start_transactions = stats->i2c_transactions;
+        uint64_t start_bytes = stats->i2c_bytes;
+        uint64_t start_busy_ns = stats->i2c_busy_ns;
+        log_for_a_while(i ? lis2dw_read_fifo : reference_read_fifo);
+        transactions[i] = stats->i2c_transactions - start_transactions;
+        bytes[i] = stats->i2c_bytes - start_bytes;
+        busy_ns[i] = stats->i2c_busy_ns - start_busy_ns;
+    }
+
+    printf("  sample at a time: %6llu transactions, %6llu bytes, %7.2f ms on the bus per second\n",
+           (unsigned long long)transactions[0], (unsigned long long)bytes[0], busy_ns[0] / 1e6 / LOGGING_SECONDS);
+    printf("  burst:            %6llu transactions, %6llu bytes, %7.2f ms on the bus per second (%.1fx)\n",
+           (unsigned long long)transactions[1], (unsigned long long)bytes[1], busy_ns[1] / 1e6 / LOGGING_SECONDS,
+           (double)busy_ns[0] / busy_ns[1]);
+    CHECK(transactions[1] == 4 * LOGGING_SECONDS); // read8 of FIFO_SAMPLE, then the burst
+    CHECK(busy_ns[1] < busy_ns[0]);
+}
+
+static void test_threshold_interrupt(void) {
+    printf("FIFO threshold interrupt\n");
+    lis2dw_fifo_t fifo;
+
+    lis2dw_configure_fifo_threshold_int1(SAMPLES_PER_SECOND);
+    CHECK(mock.registers[LIS2DW_REG_FIFO_CTRL] == (LIS2DW_FIFO_CTRL_MODE_COLLECT_CONTINUOUS | SAMPLES_PER_SECOND));
+    CHECK(mock.registers[LIS2DW_REG_CTRL7] & LIS2DW_CTRL7_VAL_INTERRUPTS_ENABLE);
+
+    mock_fill(SAMPLES_PER_SECOND - 1, false);
+    CHECK(!mock_int1());
+    mock_fill(SAMPLES_PER_SECOND + 2, false);
+    CHECK(mock_int1());
+    lis2dw_read_fifo(&fifo);
+    CHECK(fifo.count == SAMPLES_PER_SECOND + 2);
+    CHECK(!mock_int1());
+}
+
+int main(void) {
+    watch_host_i2c_device_t device = { LIS2DW_ADDRESS, mock_write, mock_read, NULL };
+    watch_host_attach_i2c_device(&device);
+
+    test_fifo();
+    benchmark();
+    test_threshold_interrupt();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+
+    printf("all checks passed\n");
+    return 0;
+}
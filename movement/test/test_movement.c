@@ -0,0 +1,502 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 The Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Boots Movement itself on the host backend, with the stand-in watch faces from test_movement_config.h, and
+// runs it against the virtual clock the way watch-library/host/main.c does. movement.c is included rather than
+// linked, so that the tests can look at its internals (the scheduled task list, for one) as well as at what the
+// faces get called with. Everything shares the one boot, so each test picks up the clock where the last left it.
+
+#include <stdio.h>
+#include <string.h>
+#include "watch.h"
+#include "watch_utility.h"
+#include "watch_host.h"
+
+// how Movement last armed the RTC alarm.
+static watch_date_time armed_alarm_time;
+static watch_rtc_alarm_match armed_alarm_mask;
+
+static void record_alarm_callback(ext_irq_cb_t callback, watch_date_time alarm_time, watch_rtc_alarm_match mask) {
+    armed_alarm_time = alarm_time;
+    armed_alarm_mask = mask;
+    watch_rtc_register_alarm_callback(callback, alarm_time, mask);
+}
+
+#define watch_rtc_register_alarm_callback record_alarm_callback
+#include "../movement.c"
+#undef watch_rtc_register_alarm_callback
+
+// what we charge a face each time Movement calls it in the background: about what reading the RTC and checking the
+// time costs at 4 MHz. the host doesn't otherwise charge for the time the app spends awake between interrupts.
+#define TEST_FACE_CALL_NS (50 * 1000)
+
+typedef enum {
+    TEST_FACE_PLAYS_NOTHING = 0,
+    TEST_FACE_PLAYS_SIGNAL,
+    TEST_FACE_PLAYS_ALARM,
+} test_face_plays_t;
+
+typedef struct {
+    uint32_t background_tasks;
+    watch_date_time last_background_task;
+    uint64_t last_background_task_ns;
+    uint64_t last_background_task_wake;     // which wake from standby it came on
+    bool polls_top_of_hour;     // for the polling faces, whether wants_background_task asks for the top of the hour
+    test_face_plays_t plays;    // what the face sounds on its background task, like a chime or an alarm would
+} test_face_state_t;
+
+static test_face_state_t test_faces[MOVEMENT_NUM_FACES];
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+void test_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
+    (void) settings;
+    if (*context_ptr == NULL) *context_ptr = &test_faces[watch_face_index];
+}
+
+void test_face_activate(movement_settings_t *settings, void *context) {
+    (void) settings;
+    (void) context;
+}
+
+bool test_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
+    test_face_state_t *state = (test_face_state_t *)context;
+    (void) settings;
+
+    switch (event.event_type) {
+        case EVENT_BACKGROUND_TASK:
+            state->background_tasks++;
+            state->last_background_task = watch_rtc_get_date_time();
+            state->last_background_task_ns = watch_host_get_time_ns();
+            state->last_background_task_wake = watch_host_get_stats()->wakeups[WATCH_HOST_POWER_STANDBY];
+            watch_host_advance(TEST_FACE_CALL_NS);
+            if (state->plays == TEST_FACE_PLAYS_SIGNAL) movement_play_signal();
+            else if (state->plays == TEST_FACE_PLAYS_ALARM) movement_play_alarm_beeps(1, BUZZER_NOTE_C8);
+            break;
+        case EVENT_TIMEOUT:
+            break;
+        default:
+            return movement_default_loop_handler(event, settings);
+    }
+
+    return true;
+}
+
+void test_face_resign(movement_settings_t *settings, void *context) {
+    (void) settings;
+    (void) context;
+}
+
+bool test_face_wants_background_task(movement_settings_t *settings, void *context) {
+    test_face_state_t *state = (test_face_state_t *)context;
+    (void) settings;
+
+    // otherwise, it's as if the face wasn't there.
+    if (!state->polls_top_of_hour) return false;
+    watch_host_advance(TEST_FACE_CALL_NS);
+    return watch_rtc_get_date_time().unit.minute == 0;
+}
+
+// runs the main loop until the virtual clock reaches time_ns, including the pass that handles whatever woke us then.
+static void run_until(uint64_t time_ns) {
+    while (true) {
+        bool can_sleep = app_loop();
+        watch_display_commit();
+        if (watch_host_get_time_ns() >= time_ns) break;
+        if (can_sleep) {
+            app_prepare_for_standby();
+            watch_host_wait_for_interrupt(WATCH_HOST_POWER_STANDBY);
+            app_wake_from_standby();
+        } else {
+            watch_host_advance(WATCH_HOST_NSEC_PER_MSEC);
+        }
+    }
+}
+
+// runs until the next time the RTC turns over to the given second of the minute.
+static void run_to_second(uint8_t second) {
+    uint64_t now = watch_host_get_time_ns();
+    uint8_t seconds = (second + 60 - watch_rtc_get_date_time().unit.second) % 60;
+
+    if (seconds == 0) seconds = 60;
+    run_until(now - now % WATCH_HOST_NSEC_PER_SEC + seconds * WATCH_HOST_NSEC_PER_SEC);
+}
+
+// the date and time the given number of seconds from now.
+static watch_date_time seconds_from_now(uint32_t seconds) {
+    return watch_utility_date_time_from_unix_time(watch_utility_date_time_to_unix_time(watch_rtc_get_date_time(), 0) + seconds, 0);
+}
+
+static bool scheduled_task_order_is(uint8_t count, const uint8_t *order) {
+    if (num_scheduled_tasks != count) return false;
+    return memcmp(scheduled_task_order, order, count) == 0;
+}
+
+static void test_scheduled_task_list(void) {
+    printf("keeping the scheduled task list in order\n");
+
+    // ties go behind the tasks that were already waiting.
+    _movement_insert_scheduled_task(2, seconds_from_now(30));
+    _movement_insert_scheduled_task(0, seconds_from_now(10));
+    _movement_insert_scheduled_task(3, seconds_from_now(20));
+    _movement_insert_scheduled_task(1, seconds_from_now(10));
+    CHECK(scheduled_task_order_is(4, (const uint8_t[]){ 0, 1, 3, 2 }));
+    CHECK(movement_state.has_scheduled_background_task);
+
+    // scheduling a face again moves its task rather than adding another.
+    _movement_insert_scheduled_task(2, seconds_from_now(5));
+    CHECK(scheduled_task_order_is(4, (const uint8_t[]){ 2, 0, 1, 3 }));
+    _movement_insert_scheduled_task(2, seconds_from_now(3600));
+    CHECK(scheduled_task_order_is(4, (const uint8_t[]){ 0, 1, 3, 2 }));
+
+    _movement_remove_scheduled_task(1);
+    CHECK(scheduled_task_order_is(3, (const uint8_t[]){ 0, 3, 2 }));
+    CHECK(scheduled_tasks[1].reg == 0);
+    // removing a face with nothing scheduled changes nothing.
+    _movement_remove_scheduled_task(1);
+    CHECK(scheduled_task_order_is(3, (const uint8_t[]){ 0, 3, 2 }));
+    _movement_remove_scheduled_task(2);
+    CHECK(scheduled_task_order_is(2, (const uint8_t[]){ 0, 3 }));
+    _movement_remove_scheduled_task(0);
+    _movement_remove_scheduled_task(3);
+    CHECK(num_scheduled_tasks == 0);
+    CHECK(!movement_state.has_scheduled_background_task);
+
+    // and the alarm goes back to the top of the minute.
+    _movement_arm_alarm();
+    CHECK(armed_alarm_mask == ALARM_MATCH_SS && armed_alarm_time.unit.second == 59);
+}
+
+static void test_same_second(void) {
+    printf("two tasks due in the same second\n");
+    test_face_state_t before[MOVEMENT_NUM_FACES];
+
+    run_to_second(10);
+    memcpy(before, test_faces, sizeof(test_faces));
+    watch_date_time due = seconds_from_now(20);
+    movement_schedule_background_task_for_face(1, due);
+    movement_schedule_background_task_for_face(2, due);
+    // the alarm matches a second early, since it fires at the end of the second it matches.
+    CHECK(armed_alarm_mask == ALARM_MATCH_HHMMSS && armed_alarm_time.unit.second == 29);
+
+    run_to_second(40);
+    CHECK(test_faces[1].background_tasks == before[1].background_tasks + 1);
+    CHECK(test_faces[2].background_tasks == before[2].background_tasks + 1);
+    CHECK(test_faces[1].last_background_task.reg == due.reg);
+    CHECK(test_faces[2].last_background_task.reg == due.reg);
+    // both on the one wake, right as the second started.
+    CHECK(test_faces[1].last_background_task_wake == test_faces[2].last_background_task_wake);
+    CHECK(test_faces[1].last_background_task_ns % WATCH_HOST_NSEC_PER_SEC == 0);
+    CHECK(test_faces[0].background_tasks == before[0].background_tasks);
+    CHECK(test_faces[3].background_tasks == before[3].background_tasks);
+    CHECK(num_scheduled_tasks == 0);
+    CHECK(armed_alarm_mask == ALARM_MATCH_SS && armed_alarm_time.unit.second == 59);
+}
+
+static void test_rearm_at_59(void) {
+    printf("re-arming the alarm for the top of the minute from :59\n");
+    test_face_state_t before[MOVEMENT_NUM_FACES];
+    movement_subscription_t every_minute = { MOVEMENT_SUBSCRIBE_EVERY_N_MINUTES, 0, 1 };
+
+    // face 3 listens for the top of the minute, which is the alarm we have to get back to.
+    CHECK(movement_subscribe_background_task_for_face(3, every_minute));
+    run_to_second(40);
+    memcpy(before, test_faces, sizeof(test_faces));
+    watch_date_time last_second = seconds_from_now(19);
+    watch_date_time next_minute = seconds_from_now(25);
+    movement_schedule_background_task_for_face(1, last_second);
+    movement_schedule_background_task_for_face(2, next_minute);
+    CHECK(armed_alarm_mask == ALARM_MATCH_HHMMSS && armed_alarm_time.unit.second == 58);
+
+    run_to_second(59);
+    CHECK(test_faces[1].background_tasks == before[1].background_tasks + 1);
+    CHECK(test_faces[1].last_background_task.reg == last_second.reg);
+    // the next task is in the next minute, so the alarm falls back to the top of this one.
+    CHECK(num_scheduled_tasks == 1);
+    CHECK(armed_alarm_mask == ALARM_MATCH_SS && armed_alarm_time.unit.second == 59);
+
+    run_to_second(0);
+    CHECK(test_faces[3].background_tasks == before[3].background_tasks + 1);
+    CHECK(test_faces[3].last_background_task.unit.second == 0);
+    // which hands over to the task once we're in its minute.
+    CHECK(armed_alarm_mask == ALARM_MATCH_HHMMSS && armed_alarm_time.unit.second == 4);
+
+    run_to_second(10);
+    CHECK(test_faces[2].background_tasks == before[2].background_tasks + 1);
+    CHECK(test_faces[2].last_background_task.reg == next_minute.reg);
+    CHECK(test_faces[3].background_tasks == before[3].background_tasks + 1);
+    CHECK(num_scheduled_tasks == 0);
+    CHECK(armed_alarm_mask == ALARM_MATCH_SS && armed_alarm_time.unit.second == 59);
+    movement_unsubscribe_all_background_tasks_for_face(3);
+}
+
+// what each face is subscribed to in the tests below, so that we can work out for ourselves when it should fire.
+static movement_subscription_t subscribed[MOVEMENT_NUM_FACES];
+
+static void subscribe(uint8_t watch_face_index, movement_subscription_t subscription) {
+    movement_unsubscribe_all_background_tasks_for_face(watch_face_index);
+    subscribed[watch_face_index] = subscription;
+    CHECK(movement_subscribe_background_task_for_face(watch_face_index, subscription));
+}
+
+static void unsubscribe_all(void) {
+    for(uint8_t i = 0; i < MOVEMENT_NUM_FACES; i++) {
+        movement_unsubscribe_all_background_tasks_for_face(i);
+        subscribed[i].type = MOVEMENT_SUBSCRIBE_NONE;
+    }
+    CHECK(num_subscriptions == 0);
+}
+
+static bool subscription_matches(movement_subscription_t subscription, watch_date_time date_time) {
+    switch (subscription.type) {
+        case MOVEMENT_SUBSCRIBE_TOP_OF_HOUR:
+            return date_time.unit.minute == 0;
+        case MOVEMENT_SUBSCRIBE_AT_TIME:
+            return date_time.unit.hour == subscription.hour && date_time.unit.minute == subscription.minute;
+        case MOVEMENT_SUBSCRIBE_EVERY_N_MINUTES:
+            return date_time.unit.minute % subscription.minute == 0;
+        default:
+            return false;
+    }
+}
+
+// runs to the top of each of the next few minutes, and checks that the subscribed faces got a background task in
+// exactly the minutes their subscriptions match, and the others got none.
+static void check_minutes(uint16_t minutes) {
+    for(uint16_t i = 0; i < minutes; i++) {
+        uint32_t before[MOVEMENT_NUM_FACES];
+        for(uint8_t j = 0; j < MOVEMENT_NUM_FACES; j++) before[j] = test_faces[j].background_tasks;
+        run_to_second(0);
+        watch_date_time now = watch_rtc_get_date_time();
+        for(uint8_t j = 0; j < MOVEMENT_NUM_FACES; j++) {
+            uint32_t expected = before[j] + subscription_matches(subscribed[j], now);
+            if (test_faces[j].background_tasks != expected) {
+                printf("  FAIL face %d at %02d:%02d: %u background task(s), expected %u\n", j, now.unit.hour, now.unit.minute,
+                       test_faces[j].background_tasks - before[j], expected - before[j]);
+                failures++;
+            }
+        }
+    }
+}
+
+// sets the RTC to the given time of day, on the same date, half way through the minute.
+static void set_time_of_day(uint8_t hour, uint8_t minute) {
+    watch_date_time date_time = watch_rtc_get_date_time();
+    date_time.unit.hour = hour;
+    date_time.unit.minute = minute;
+    date_time.unit.second = 30;
+    watch_rtc_set_date_time(date_time);
+}
+
+static void test_subscriptions_hour_rollover(void) {
+    printf("subscriptions across the top of the hour\n");
+
+    subscribe(1, (movement_subscription_t){ MOVEMENT_SUBSCRIBE_TOP_OF_HOUR, 0, 0 });
+    // 7 doesn't divide the hour, so this fires at :56 and then again at :00, not at :03.
+    subscribe(2, (movement_subscription_t){ MOVEMENT_SUBSCRIBE_EVERY_N_MINUTES, 0, 7 });
+    subscribe(3, (movement_subscription_t){ MOVEMENT_SUBSCRIBE_AT_TIME, 11, 1 });
+    set_time_of_day(10, 45);
+    check_minutes(30);
+    unsubscribe_all();
+}
+
+static void test_subscriptions_day_rollover(void) {
+    printf("subscriptions across midnight\n");
+
+    subscribe(0, (movement_subscription_t){ MOVEMENT_SUBSCRIBE_AT_TIME, 0, 0 });
+    subscribe(1, (movement_subscription_t){ MOVEMENT_SUBSCRIBE_AT_TIME, 23, 58 });
+    subscribe(2, (movement_subscription_t){ MOVEMENT_SUBSCRIBE_EVERY_N_MINUTES, 0, 7 });
+    subscribe(3, (movement_subscription_t){ MOVEMENT_SUBSCRIBE_TOP_OF_HOUR, 0, 0 });
+    set_time_of_day(23, 50);
+    check_minutes(20);
+    unsubscribe_all();
+}
+
+static void test_subscriptions_clock_set(void) {
+    printf("subscriptions when the clock is set\n");
+
+    subscribe(1, (movement_subscription_t){ MOVEMENT_SUBSCRIBE_AT_TIME, 8, 30 });
+    subscribe(2, (movement_subscription_t){ MOVEMENT_SUBSCRIBE_EVERY_N_MINUTES, 0, 7 });
+    subscribe(3, (movement_subscription_t){ MOVEMENT_SUBSCRIBE_TOP_OF_HOUR, 0, 0 });
+
+    // backwards: nothing in between fires, and what comes up again fires again.
+    set_time_of_day(9, 10);
+    check_minutes(3);
+    set_time_of_day(8, 25);
+    check_minutes(40);
+
+    // forwards: what we skipped over stays skipped, but the minute we land in still counts.
+    set_time_of_day(12, 2);
+    check_minutes(3);
+    set_time_of_day(17, 55);
+    check_minutes(10);
+
+    // by a whole day, to the minute: this still counts as a new minute.
+    watch_date_time date_time = seconds_from_now(24 * 60 * 60 - 60);
+    watch_rtc_set_date_time(date_time);
+    check_minutes(3);
+    unsubscribe_all();
+}
+
+// how long one round of alarm beeps has the buzzer on, in 1/64 s sequencer ticks: three short beeps and a long one,
+// each held a tick longer than written.
+#define ALARM_ROUND_BEEP_TICKS (3 * 3 + 5)
+
+// has faces 1 and 2 sound the given things at the top of the given hour, in that order, while the watch is in low
+// energy mode: like the clock face's chime and the alarm face going off together.
+static void check_signal_and_alarm(uint8_t hour, test_face_plays_t first, test_face_plays_t second) {
+    const watch_host_stats_t *stats = watch_host_get_stats();
+
+    test_faces[1].plays = first;
+    test_faces[2].plays = second;
+    subscribe(1, (movement_subscription_t){ MOVEMENT_SUBSCRIBE_TOP_OF_HOUR, 0, 0 });
+    subscribe(2, (movement_subscription_t){ MOVEMENT_SUBSCRIBE_AT_TIME, hour, 0 });
+    set_time_of_day(hour - 1, 59);
+    // go to sleep on the next pass through the loop.
+    movement_state.settings.bit.le_interval = 1;
+    movement_state.le_mode_ticks = 0;
+
+    uint64_t slept = stats->time_ns[WATCH_HOST_POWER_SLEEP];
+    uint64_t buzzed = stats->load_ns[WATCH_HOST_LOAD_BUZZER];
+    uint32_t tasks[2] = { test_faces[1].background_tasks, test_faces[2].background_tasks };
+    run_to_second(30);
+
+    CHECK(stats->time_ns[WATCH_HOST_POWER_SLEEP] - slept >= 29 * WATCH_HOST_NSEC_PER_SEC);
+    CHECK(test_faces[1].background_tasks == tasks[0] + 1);
+    CHECK(test_faces[2].background_tasks == tasks[1] + 1);
+    // whichever order they came in, the alarm plays out in full...
+    CHECK(stats->load_ns[WATCH_HOST_LOAD_BUZZER] - buzzed == ALARM_ROUND_BEEP_TICKS * WATCH_HOST_NSEC_PER_SEC / 64);
+    // ...and once it's done, nothing is left playing, and the buzzer goes back off, as it was when they started.
+    CHECK(!movement_state.is_buzzing);
+    CHECK(!movement_state.is_alarm_playing);
+    CHECK(!watch_is_buzzer_or_led_enabled());
+
+    unsubscribe_all();
+    test_faces[1].plays = TEST_FACE_PLAYS_NOTHING;
+    test_faces[2].plays = TEST_FACE_PLAYS_NOTHING;
+    movement_state.settings.bit.le_interval = 0;
+    _movement_reset_inactivity_countdown();
+}
+
+static void test_signal_and_alarm(void) {
+    printf("the signal and an alarm in the same minute\n");
+
+    check_signal_and_alarm(21, TEST_FACE_PLAYS_SIGNAL, TEST_FACE_PLAYS_ALARM);
+    check_signal_and_alarm(22, TEST_FACE_PLAYS_ALARM, TEST_FACE_PLAYS_SIGNAL);
+}
+
+static void test_claim_context(void) {
+    printf("claiming contexts\n");
+    const watch_face_context_t *reserved = &watch_faces[8].context;
+
+    CHECK(reserved->size == sizeof(uint32_t));
+    CHECK(movement_claim_context(8, sizeof(uint32_t)) == reserved->storage);
+    CHECK(movement_claim_context(8, sizeof(uint16_t)) == reserved->storage);
+    // a face whose state outgrew its reservation gets nothing, rather than heap the build didn't count...
+    CHECK(movement_claim_context(8, sizeof(uint64_t)) == NULL);
+    // ...while a face that reserves nothing still gets heap.
+    void *heap = movement_claim_context(0, sizeof(uint64_t));
+    CHECK(heap != NULL);
+    free(heap);
+}
+
+// the charge the energy model has the watch drawing so far, in µC.
+static double charge_so_far(void) {
+    return watch_host_get_average_current(NULL) * watch_host_get_time_ns() / WATCH_HOST_NSEC_PER_SEC;
+}
+
+static uint32_t face_calls(uint8_t first, uint8_t count) {
+    uint32_t calls = 0;
+    for(uint8_t i = first; i < first + count; i++) calls += face_perf[i].background_checks + face_perf[i].background_tasks;
+    return calls;
+}
+
+static void measure_subscriptions(void) {
+    printf("a day of top-of-the-hour background tasks for four faces\n");
+    printf("                   face calls   current (uA)\n");
+    uint64_t day = 24ULL * 60 * 60 * WATCH_HOST_NSEC_PER_SEC;
+    uint32_t calls[2];
+    double current[2];
+
+    // faces 4 to 7 ask for it the old way, through wants_background_task every minute...
+    run_to_second(30);
+    for(uint8_t i = 4; i < 8; i++) test_faces[i].polls_top_of_hour = true;
+    calls[0] = face_calls(4, 4);
+    current[0] = charge_so_far();
+    run_until(watch_host_get_time_ns() + day);
+    calls[0] = face_calls(4, 4) - calls[0];
+    current[0] = (charge_so_far() - current[0]) / (day / WATCH_HOST_NSEC_PER_SEC);
+    for(uint8_t i = 4; i < 8; i++) test_faces[i].polls_top_of_hour = false;
+
+    // ...and faces 0 to 3 subscribe to it.
+    for(uint8_t i = 0; i < 4; i++) subscribe(i, (movement_subscription_t){ MOVEMENT_SUBSCRIBE_TOP_OF_HOUR, 0, 0 });
+    calls[1] = face_calls(0, 4);
+    current[1] = charge_so_far();
+    run_until(watch_host_get_time_ns() + day);
+    calls[1] = face_calls(0, 4) - calls[1];
+    current[1] = (charge_so_far() - current[1]) / (day / WATCH_HOST_NSEC_PER_SEC);
+    unsubscribe_all();
+
+    printf("  polling          %10u %14.4f\n", calls[0], current[0]);
+    printf("  subscriptions    %10u %14.4f\n", calls[1], current[1]);
+    printf("  saved            %10u %14.4f\n", calls[0] - calls[1], current[0] - current[1]);
+    CHECK(calls[0] == 4 * (24 * 60 + 24));
+    CHECK(calls[1] == 4 * 24);
+    CHECK(current[1] < current[0]);
+}
+
+int main(void) {
+    watch_date_time start = {0};
+    start.unit.year = 2026 - WATCH_RTC_REFERENCE_YEAR;
+    start.unit.month = 1;
+    start.unit.day = 1;
+    start.unit.hour = 10;
+
+    app_init();
+    // the tests that want low energy mode turn it on themselves.
+    movement_state.settings.bit.le_interval = 0;
+    _watch_init();
+    watch_rtc_set_date_time(start);
+    app_setup();
+    run_until(WATCH_HOST_NSEC_PER_MSEC);
+
+    test_claim_context();
+    test_scheduled_task_list();
+    test_same_second();
+    test_rearm_at_59();
+    test_subscriptions_hour_rollover();
+    test_subscriptions_day_rollover();
+    test_subscriptions_clock_set();
+    test_signal_and_alarm();
+    measure_subscriptions();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,85 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 The Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef TEST_MOVEMENT_CONFIG_H_
+#define TEST_MOVEMENT_CONFIG_H_
+
+// The watch faces test_movement.c boots Movement with, in place of movement_config.h. They're all the same face,
+// which does nothing but note what Movement asked of it; see test_movement.c. Faces 4 to 7 also answer
+// wants_background_task, the way faces did before they could subscribe, and the last one reserves a context.
+
+#include "movement.h"
+
+void test_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
+void test_face_activate(movement_settings_t *settings, void *context);
+bool test_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
+void test_face_resign(movement_settings_t *settings, void *context);
+bool test_face_wants_background_task(movement_settings_t *settings, void *context);
+
+#define test_face ((const watch_face_t){ \
+    test_face_setup, \
+    test_face_activate, \
+    test_face_loop, \
+    test_face_resign, \
+    NULL, \
+    MOVEMENT_NO_CONTEXT, \
+})
+
+#define polling_test_face ((const watch_face_t){ \
+    test_face_setup, \
+    test_face_activate, \
+    test_face_loop, \
+    test_face_resign, \
+    test_face_wants_background_task, \
+    MOVEMENT_NO_CONTEXT, \
+})
+
+#define reserving_test_face ((const watch_face_t){ \
+    test_face_setup, \
+    test_face_activate, \
+    test_face_loop, \
+    test_face_resign, \
+    NULL, \
+    MOVEMENT_CONTEXT(uint32_t), \
+})
+
+const watch_face_t watch_faces[] = {
+    test_face,
+    test_face,
+    test_face,
+    test_face,
+    polling_test_face,
+    polling_test_face,
+    polling_test_face,
+    polling_test_face,
+    reserving_test_face,
+};
+
+#define MOVEMENT_NUM_FACES (sizeof(watch_faces) / sizeof(watch_face_t))
+
+#define SIGNAL_TUNE_DEFAULT
+
+#define MOVEMENT_DEFAULT_BUTTON_SOUND false
+
+#endif // TEST_MOVEMENT_CONFIG_H_
@@ -0,0 +1,161 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 The Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Reads the host backend's emulated SPI NOR flash (see watch-library/host/watch/watch_spi.c) in streams of
+// random-sized chunks, which have to come out the same as the flash's contents, and checks that a stream waits
+// for an erase to finish. Then compares the throughput of streams with spi_flash_read_data for a few chunk sizes;
+// the emulated bus charges for each call and for each byte, much like the SERCOM does.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "spiflash.h"
+#include "watch_host.h"
+
+#define BENCHMARK_BYTES 65536
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+// cheap deterministic PRNG so that runs are repeatable.
+static uint32_t rng_state = 0x2545F491;
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static void test_stream(void) {
+    printf("streams of random chunks\n");
+    watch_host_stats_t *stats = watch_host_get_stats();
+    uint32_t size;
+    uint8_t *flash = watch_host_get_spi_flash(&size);
+    static uint8_t buf[16384];
+    uint32_t mismatches = 0;
+
+    for (uint32_t i = 0; i < size; i++) flash[i] = next_random();
+
+    for (int trial = 0; trial < 1000; trial++) {
+        uint32_t address = next_random() % (size - sizeof(buf));
+        uint32_t length = 0;
+        uint16_t chunks = 1 + next_random() % 32;
+
+        uint64_t commands = stats->spi_flash_commands;
+        CHECK(spi_flash_stream_open(address));
+        for (uint16_t i = 0; i < chunks; i++) {
+            uint16_t chunk = 1 + next_random() % 512;
+            CHECK(spi_flash_stream_read(buf + length, chunk));
+            length += chunk;
+        }
+        spi_flash_stream_close();
+
+        if (memcmp(buf, flash + address, length)) mismatches++;
+        // a status check, then the read.
+        CHECK(stats->spi_flash_commands - commands == 2);
+    }
+    CHECK(mismatches == 0);
+
+    // the flash doesn't answer while it's erasing, so the stream has to wait for it.
+    CHECK(spi_flash_command(CMD_ENABLE_WRITE));
+    CHECK(spi_flash_sector_command(CMD_SECTOR_ERASE, 8 * SPI_FLASH_SECTOR_SIZE));
+    CHECK(spi_flash_stream_open(8 * SPI_FLASH_SECTOR_SIZE + 100));
+    CHECK(spi_flash_stream_read(buf, 16));
+    spi_flash_stream_close();
+    bool erased = true;
+    for (uint8_t i = 0; i < 16; i++) if (buf[i] != 0xFF) erased = false;
+    CHECK(erased);
+}
+
+typedef struct {
+    uint64_t calls;
+    uint64_t bytes;
+    uint64_t busy_ns;
+} cost_t;
+
+static cost_t cost_since(cost_t start) {
+    watch_host_stats_t *stats = watch_host_get_stats();
+    cost_t cost = {
+        stats->spi_calls - start.calls,
+        stats->spi_bytes - start.bytes,
+        stats->spi_busy_ns - start.busy_ns,
+    };
+    return cost;
+}
+
+static void print_cost(const char *name, uint16_t chunk, cost_t cost) {
+    printf("  %-12s %4d byte chunks %6llu calls, %6llu bytes, %7.1f ms on the bus, %5.1f kB/s\n", name, chunk,
+           (unsigned long long)cost.calls, (unsigned long long)cost.bytes, cost.busy_ns / 1e6,
+           BENCHMARK_BYTES / 1024.0 / (cost.busy_ns / 1e9));
+}
+
+static void benchmark(void) {
+    printf("reading %d kB\n", BENCHMARK_BYTES / 1024);
+    static const uint16_t chunks[] = { 16, 256, 4096 };
+    static uint8_t buf[BENCHMARK_BYTES];
+    uint8_t *flash = watch_host_get_spi_flash(NULL);
+    cost_t zero = { 0 }, start, cost[2];
+
+    for (uint8_t i = 0; i < sizeof(chunks) / sizeof(chunks[0]); i++) {
+        uint16_t chunk = chunks[i];
+
+        spi_flash_wait_until_ready();
+        start = cost_since(zero);
+        for (uint32_t address = 0; address < BENCHMARK_BYTES; address += chunk) {
+            CHECK(spi_flash_read_data(address, buf + address, chunk));
+        }
+        cost[0] = cost_since(start);
+        CHECK(memcmp(buf, flash, BENCHMARK_BYTES) == 0);
+
+        memset(buf, 0, sizeof(buf));
+        start = cost_since(zero);
+        CHECK(spi_flash_stream_open(0));
+        for (uint32_t address = 0; address < BENCHMARK_BYTES; address += chunk) {
+            CHECK(spi_flash_stream_read(buf + address, chunk));
+        }
+        spi_flash_stream_close();
+        cost[1] = cost_since(start);
+        CHECK(memcmp(buf, flash, BENCHMARK_BYTES) == 0);
+
+        print_cost("read_data", chunk, cost[0]);
+        print_cost("stream", chunk, cost[1]);
+        CHECK(cost[1].busy_ns < cost[0].busy_ns);
+    }
+}
+
+int main(void) {
+    spi_flash_init();
+
+    test_stream();
+    benchmark();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+
+    printf("all checks passed\n");
+    return 0;
+}
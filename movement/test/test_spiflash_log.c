@@ -0,0 +1,377 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 The Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Runs spiflash_log.c over the host backend's emulated SPI NOR flash (see watch-library/host/watch/watch_spi.c):
+// records have to come back as they went in, across remounts, with the append cursor found again by the
+// binary search; a full log has to refuse records without losing any; and pages the log didn't write must
+// not be programmed over. Then compares what a hundred pages of accelerometer records cost the flash against
+// the scheme accelerometer_data_acquisition_face used before, which is kept below as a reference, and what
+// reading them back costs page by page and in one stream.
+
+#include <stdio.h>
+#include <string.h>
+#include "spiflash.h"
+#include "spiflash_log.h"
+#include "watch_host.h"
+
+#define RECORD_SIZE 8
+#define BENCHMARK_PAGES 100
+
+static int failures = 0;
+
+#define CHECK(cond) do { if (!(cond)) { printf("  FAIL %s:%d: %s\n", __FILE__, __LINE__, #cond); failures++; } } while (0)
+
+// cheap deterministic PRNG so that runs are repeatable.
+static uint32_t rng_state = 0x2545F491;
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+    return rng_state;
+}
+
+static void make_record(uint8_t *record, uint32_t n) {
+    uint32_t r = next_random();
+    memcpy(record, &n, 4);
+    memcpy(record + 4, &r, 4);
+}
+
+static uint8_t expected[4000][RECORD_SIZE];
+
+// reads the whole log back, and compares it to the first count records in expected.
+static bool log_matches(spi_flash_log_t *log, uint32_t count) {
+    uint8_t records[SPI_FLASH_LOG_PAYLOAD_SIZE];
+    spi_flash_log_header_t header;
+    uint32_t n = 0;
+
+    for (uint16_t i = 0; i < spi_flash_log_get_page_count(log); i++) {
+        if (!spi_flash_log_read_page(log, i, &header, records)) return false;
+        if (header.sequence != i || n + header.record_count > count) return false;
+        if (memcmp(records, expected[n], header.record_count * RECORD_SIZE)) return false;
+        n += header.record_count;
+    }
+
+    return n == count;
+}
+
+typedef struct {
+    uint32_t records;   // records seen so far
+    uint32_t pages;     // pages seen so far
+    uint32_t stop_at;   // stop after this many pages
+    bool matches;       // whether everything so far matched expected
+} read_all_state_t;
+
+static bool check_page(const spi_flash_log_header_t *header, const void *records, void *context) {
+    read_all_state_t *state = context;
+    if (header->sequence != state->pages || memcmp(records, expected[state->records], header->record_count * RECORD_SIZE)) {
+        state->matches = false;
+    }
+    state->records += header->record_count;
+    state->pages++;
+    return state->pages < state->stop_at;
+}
+
+static void test_append_and_remount(void) {
+    printf("appending, flushing and remounting\n");
+    spi_flash_log_t log;
+    uint32_t count = 0;
+
+    CHECK(spi_flash_log_mount(&log, 64, 256, RECORD_SIZE));
+    CHECK(spi_flash_log_erase(&log));
+    CHECK(log.records_per_page == 31);
+
+    // a few sessions of different lengths, each flushed at the end and remounted, like the face does.
+    for (int session = 0; session < 8; session++) {
+        uint32_t length = 1 + next_random() % 400;
+        for (uint32_t i = 0; i < length; i++, count++) {
+            make_record(expected[count], count);
+            CHECK(spi_flash_log_append(&log, expected[count]));
+        }
+        CHECK(spi_flash_log_flush(&log));
+        uint16_t pages = log.next_page;
+
+        spi_flash_log_t remounted;
+        CHECK(spi_flash_log_mount(&remounted, 64, 256, RECORD_SIZE));
+        CHECK(remounted.next_page == pages);
+        CHECK(log_matches(&remounted, count));
+        log = remounted;
+    }
+
+    // the wrong record size, and parameters that aren't whole sectors, are turned away.
+    spi_flash_log_header_t header;
+    uint8_t records[SPI_FLASH_LOG_PAYLOAD_SIZE];
+    spi_flash_log_t other;
+    CHECK(spi_flash_log_mount(&other, 64, 256, 12));
+    CHECK(!spi_flash_log_read_page(&other, 0, &header, records));
+    CHECK(!spi_flash_log_mount(&other, 65, 256, RECORD_SIZE));
+    CHECK(!spi_flash_log_mount(&other, 64, 100, RECORD_SIZE));
+    CHECK(!spi_flash_log_mount(&other, 64, 256, 0));
+}
+
+static void test_mount(void) {
+    printf("finding the end of the log\n");
+    watch_host_stats_t *stats = watch_host_get_stats();
+    static const uint16_t lengths[] = { 0, 1, 2, 15, 16, 17, 100, 255, 256, 511, 512 };
+    uint64_t most_commands = 0;
+    uint8_t record[RECORD_SIZE] = { 0 };
+
+    for (uint8_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+        spi_flash_log_t log;
+        CHECK(spi_flash_log_mount(&log, 1024, 512, RECORD_SIZE));
+        CHECK(spi_flash_log_erase(&log));
+        for (uint32_t j = 0; j < (uint32_t)lengths[i] * log.records_per_page; j++) spi_flash_log_append(&log, record);
+
+        spi_flash_wait_until_ready();
+        uint64_t commands = stats->spi_flash_commands;
+        CHECK(spi_flash_log_mount(&log, 1024, 512, RECORD_SIZE));
+        commands = stats->spi_flash_commands - commands;
+        if (commands > most_commands) most_commands = commands;
+
+        CHECK(spi_flash_log_get_page_count(&log) == lengths[i]);
+        CHECK(spi_flash_log_get_free_pages(&log) == 512 - lengths[i]);
+    }
+    // a status check, then a header read for each step of the search.
+    printf("  at most %llu commands to mount a 512 page log\n", (unsigned long long)most_commands);
+    CHECK(most_commands <= 1 + 10);
+}
+
+static void test_full(void) {
+    printf("filling the log up\n");
+    spi_flash_log_t log;
+    uint32_t count = 0;
+
+    CHECK(spi_flash_log_mount(&log, 2048, 32, RECORD_SIZE));
+    CHECK(spi_flash_log_erase(&log));
+    while (count < sizeof(expected) / RECORD_SIZE) {
+        make_record(expected[count], count);
+        if (!spi_flash_log_append(&log, expected[count])) break;
+        count++;
+    }
+    CHECK(count == 32 * 31);
+    CHECK(spi_flash_log_flush(&log));
+    CHECK(spi_flash_log_get_free_pages(&log) == 0);
+
+    // nothing that didn't fit made it into the flash after the log.
+    uint8_t *flash = watch_host_get_spi_flash(NULL);
+    bool erased = true;
+    for (uint32_t i = 0; i < SPI_FLASH_LOG_SECTOR_SIZE; i++) if (flash[(2048 + 32) * SPI_FLASH_LOG_PAGE_SIZE + i] != 0xFF) erased = false;
+    CHECK(erased);
+
+    spi_flash_log_t remounted;
+    CHECK(spi_flash_log_mount(&remounted, 2048, 32, RECORD_SIZE));
+    CHECK(spi_flash_log_get_free_pages(&remounted) == 0);
+    CHECK(!spi_flash_log_append(&remounted, expected[0]));
+    CHECK(log_matches(&remounted, count));
+
+    // reading it all in one go gives the same, and stops when asked to.
+    read_all_state_t state = { 0, 0, UINT32_MAX, true };
+    CHECK(spi_flash_log_read_all(&remounted, check_page, &state));
+    CHECK(state.matches && state.pages == 32 && state.records == count);
+    read_all_state_t stopped = { 0, 0, 5, true };
+    CHECK(!spi_flash_log_read_all(&remounted, check_page, &stopped));
+    CHECK(stopped.matches && stopped.pages == 5);
+}
+
+static void test_foreign_data(void) {
+    printf("pages the log didn't write\n");
+    spi_flash_log_t log;
+    uint8_t junk[SPI_FLASH_LOG_PAGE_SIZE];
+    uint8_t record[RECORD_SIZE] = { 0 };
+    for (uint16_t i = 0; i < sizeof(junk); i++) junk[i] = next_random();
+
+    // e.g. pages left over from the old used-page bitmap at the start of the chip.
+    CHECK(spi_flash_log_mount(&log, 3072, 64, RECORD_SIZE));
+    CHECK(spi_flash_log_erase(&log));
+    CHECK(spi_flash_wait_until_ready());
+    CHECK(spi_flash_command(CMD_ENABLE_WRITE));
+    CHECK(spi_flash_write_data(3072 * SPI_FLASH_LOG_PAGE_SIZE, junk, sizeof(junk)));
+
+    CHECK(spi_flash_log_mount(&log, 3072, 64, RECORD_SIZE));
+    CHECK(spi_flash_log_get_page_count(&log) == 1);
+    spi_flash_log_header_t header;
+    uint8_t records[SPI_FLASH_LOG_PAYLOAD_SIZE];
+    CHECK(!spi_flash_log_read_page(&log, 0, &header, records));
+    read_all_state_t state = { 0, 0, UINT32_MAX, true };
+    CHECK(!spi_flash_log_read_all(&log, check_page, &state));
+    CHECK(state.pages == 0);
+
+    for (uint8_t i = 0; i < log.records_per_page; i++) CHECK(spi_flash_log_append(&log, record));
+    uint8_t *flash = watch_host_get_spi_flash(NULL);
+    CHECK(memcmp(flash + 3072 * SPI_FLASH_LOG_PAGE_SIZE, junk, sizeof(junk)) == 0);
+    CHECK(spi_flash_log_read_page(&log, 1, &header, records));
+}
+
+// how accelerometer_data_acquisition_face wrote a page before the log: program it, read it back to check it,
+// then read the page of the used-page bitmap it belongs in and program it again with one more bit cleared.
+static void reference_write_page(uint8_t *buf, uint16_t page) {
+    uint32_t address = 256 * page;
+    uint8_t buf2[256];
+    uint8_t used_pages[256];
+
+    spi_flash_wait_until_ready();
+    spi_flash_command(CMD_ENABLE_WRITE);
+    spi_flash_write_data(address, buf, 256);
+    spi_flash_wait_until_ready();
+    spi_flash_read_data(address, buf2, 256);
+
+    uint16_t address_to_mark_used = page / 8;
+    uint8_t header_page = address_to_mark_used / 256;
+    spi_flash_read_data(header_page * 256, used_pages, 256);
+    used_pages[address_to_mark_used % 256] = 0x7F >> (page % 8);
+    spi_flash_command(CMD_ENABLE_WRITE);
+    spi_flash_write_data(header_page * 256, used_pages, 256);
+    spi_flash_wait_until_ready();
+}
+
+// and how it found the next free page: by scanning the bitmap, all 1 KB of it.
+static int16_t reference_get_next_available_page(void) {
+    uint8_t buf[256];
+    uint16_t page = 0;
+
+    for (int16_t i = 0; i < 4; i++) {
+        spi_flash_wait_until_ready();
+        spi_flash_read_data(i * 256, buf, 256);
+        for (int16_t j = 0; j < 256; j++) {
+            if (buf[j] == 0) {
+                page += 8;
+            } else {
+                page += __builtin_clz(((uint32_t)buf[j]) << 24);
+                break;
+            }
+        }
+    }
+
+    return page;
+}
+
+typedef struct {
+    uint64_t commands;
+    uint64_t bytes;
+    uint64_t page_programs;
+    uint64_t busy_ns;
+} cost_t;
+
+static cost_t cost_since(cost_t start) {
+    watch_host_stats_t *stats = watch_host_get_stats();
+    cost_t cost = {
+        stats->spi_flash_commands - start.commands,
+        stats->spi_bytes - start.bytes,
+        stats->spi_flash_page_programs - start.page_programs,
+        stats->spi_busy_ns - start.busy_ns,
+    };
+    return cost;
+}
+
+static void print_cost(const char *name, cost_t cost) {
+    printf("  %-18s %6llu commands, %7llu bytes, %4llu page programs, %8.1f ms on the bus\n", name,
+           (unsigned long long)cost.commands, (unsigned long long)cost.bytes,
+           (unsigned long long)cost.page_programs, cost.busy_ns / 1e6);
+}
+
+static void benchmark(void) {
+    printf("%d pages of accelerometer records, then finding the next free page\n", BENCHMARK_PAGES);
+    cost_t zero = { 0 }, start, write_cost[2], mount_cost[2];
+    uint8_t buf[256];
+
+    // the reference's bitmap lives in the first four pages of the chip, marked used to start with.
+    spi_flash_log_t log;
+    CHECK(spi_flash_log_mount(&log, 0, 256, RECORD_SIZE));
+    CHECK(spi_flash_log_erase(&log));
+    memset(buf, 0xFF, sizeof(buf));
+    buf[0] = 0x0F;
+    spi_flash_command(CMD_ENABLE_WRITE);
+    spi_flash_write_data(0, buf, 256);
+    spi_flash_wait_until_ready();
+
+    start = cost_since(zero);
+    for (uint16_t page = 4; page < 4 + BENCHMARK_PAGES; page++) {
+        for (uint16_t i = 0; i < sizeof(buf); i++) buf[i] = next_random();
+        reference_write_page(buf, page);
+    }
+    write_cost[0] = cost_since(start);
+    start = cost_since(zero);
+    CHECK(reference_get_next_available_page() == 4 + BENCHMARK_PAGES);
+    mount_cost[0] = cost_since(start);
+
+    CHECK(spi_flash_log_mount(&log, 256, 512, RECORD_SIZE));
+    CHECK(spi_flash_log_erase(&log));
+    start = cost_since(zero);
+    for (uint32_t i = 0; i < BENCHMARK_PAGES * log.records_per_page; i++) {
+        uint8_t record[RECORD_SIZE];
+        make_record(record, i);
+        spi_flash_log_append(&log, record);
+    }
+    write_cost[1] = cost_since(start);
+    start = cost_since(zero);
+    CHECK(spi_flash_log_mount(&log, 256, 512, RECORD_SIZE));
+    CHECK(spi_flash_log_get_page_count(&log) == BENCHMARK_PAGES);
+    mount_cost[1] = cost_since(start);
+
+    printf(" writing:\n");
+    print_cost("page and bitmap", write_cost[0]);
+    print_cost("log", write_cost[1]);
+    printf(" finding the next free page:\n");
+    print_cost("bitmap scan", mount_cost[0]);
+    print_cost("binary search", mount_cost[1]);
+    CHECK(write_cost[1].page_programs == BENCHMARK_PAGES);
+    CHECK(write_cost[1].busy_ns < write_cost[0].busy_ns);
+    CHECK(mount_cost[1].bytes < mount_cost[0].bytes);
+
+    // reading the log back, e.g. to dump it over USB.
+    cost_t read_cost[2];
+    spi_flash_log_header_t header;
+    uint8_t records[SPI_FLASH_LOG_PAYLOAD_SIZE];
+    start = cost_since(zero);
+    for (uint16_t i = 0; i < BENCHMARK_PAGES; i++) CHECK(spi_flash_log_read_page(&log, i, &header, records));
+    read_cost[0] = cost_since(start);
+    read_all_state_t state = { 0, 0, UINT32_MAX, true };
+    start = cost_since(zero);
+    CHECK(spi_flash_log_read_all(&log, check_page, &state));
+    read_cost[1] = cost_since(start);
+    CHECK(state.pages == BENCHMARK_PAGES);
+
+    printf(" reading it back:\n");
+    print_cost("page by page", read_cost[0]);
+    print_cost("one stream", read_cost[1]);
+    CHECK(read_cost[1].commands == 2);
+    CHECK(read_cost[1].busy_ns < read_cost[0].busy_ns);
+}
+
+int main(void) {
+    spi_flash_init();
+
+    test_append_and_remount();
+    test_mount();
+    test_full();
+    test_foreign_data();
+    benchmark();
+
+    if (failures) {
+        printf("%d check(s) failed\n", failures);
+        return 1;
+    }
+
+    printf("all checks passed\n");
+    return 0;
+}
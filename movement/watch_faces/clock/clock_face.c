@@ -121,7 +121,10 @@ static void clock_check_battery_periodically(clock_state_t *clock, watch_date_ti
 }
 
 static void clock_toggle_time_signal(clock_state_t *clock) {
+    movement_subscription_t hourly = { .type = MOVEMENT_SUBSCRIBE_TOP_OF_HOUR };
     clock->time_signal_enabled = !clock->time_signal_enabled;
+    if (clock->time_signal_enabled) movement_subscribe_background_task_for_face(clock->watch_face_index, hourly);
+    else movement_unsubscribe_background_task_for_face(clock->watch_face_index, hourly);
     clock_indicate_time_signal(clock);
 }
 
@@ -215,10 +218,9 @@ static void clock_stop_tick_tock_animation(void) {
 
 void clock_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(clock_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(clock_state_t));
         clock_state_t *state = (clock_state_t *) *context_ptr;
         state->time_signal_enabled = false;
         state->watch_face_index = watch_face_index;
@@ -279,13 +281,3 @@ void clock_face_resign(movement_settings_t *settings, void *context) {
     (void) settings;
     (void) context;
 }
-
-bool clock_face_wants_background_task(movement_settings_t *settings, void *context) {
-    (void) settings;
-    clock_state_t *state = (clock_state_t *) context;
-    if (!state->time_signal_enabled) return false;
-
-    watch_date_time date_time = watch_rtc_get_date_time();
-
-    return date_time.unit.minute == 0;
-}
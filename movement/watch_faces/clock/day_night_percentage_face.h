@@ -60,6 +60,7 @@ void day_night_percentage_face_resign(movement_settings_t *settings, void *conte
     day_night_percentage_face_loop, \
     day_night_percentage_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(day_night_percentage_state_t), \
 })
 
 #endif // DAY_NIGHT_PERCENTAGE_FACE_H_
@@ -48,7 +48,7 @@ static void _display_left_aligned(uint8_t value) {
 void simple_clock_bin_led_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(simple_clock_bin_led_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(simple_clock_bin_led_state_t));
         memset(*context_ptr, 0, sizeof(simple_clock_bin_led_state_t));
         simple_clock_bin_led_state_t *state = (simple_clock_bin_led_state_t *)*context_ptr;
         state->watch_face_index = watch_face_index;
@@ -174,8 +174,13 @@ bool simple_clock_bin_led_face_loop(movement_event_t event, movement_settings_t
             break;
         case EVENT_ALARM_LONG_PRESS:
             state->signal_enabled = !state->signal_enabled;
-            if (state->signal_enabled) watch_set_indicator(WATCH_INDICATOR_BELL);
-            else watch_clear_indicator(WATCH_INDICATOR_BELL);
+            if (state->signal_enabled) {
+                watch_set_indicator(WATCH_INDICATOR_BELL);
+                movement_subscribe_background_task_for_face(state->watch_face_index, (movement_subscription_t){ .type = MOVEMENT_SUBSCRIBE_TOP_OF_HOUR });
+            } else {
+                watch_clear_indicator(WATCH_INDICATOR_BELL);
+                movement_unsubscribe_background_task_for_face(state->watch_face_index, (movement_subscription_t){ .type = MOVEMENT_SUBSCRIBE_TOP_OF_HOUR });
+            }
             break;
         case EVENT_BACKGROUND_TASK:
             // uncomment this line to snap back to the clock face when the hour signal sounds:
@@ -210,13 +215,3 @@ void simple_clock_bin_led_face_resign(movement_settings_t *settings, void *conte
     (void) settings;
     (void) context;
 }
-
-bool simple_clock_bin_led_face_wants_background_task(movement_settings_t *settings, void *context) {
-    (void) settings;
-    simple_clock_bin_led_state_t *state = (simple_clock_bin_led_state_t *)context;
-    if (!state->signal_enabled) return false;
-
-    watch_date_time date_time = watch_rtc_get_date_time();
-
-    return date_time.unit.minute == 0;
-}
@@ -68,14 +68,14 @@ void simple_clock_bin_led_face_setup(movement_settings_t *settings, uint8_t watc
 void simple_clock_bin_led_face_activate(movement_settings_t *settings, void *context);
 bool simple_clock_bin_led_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
 void simple_clock_bin_led_face_resign(movement_settings_t *settings, void *context);
-bool simple_clock_bin_led_face_wants_background_task(movement_settings_t *settings, void *context);
 
 #define simple_clock_bin_led_face ((const watch_face_t){ \
     simple_clock_bin_led_face_setup, \
     simple_clock_bin_led_face_activate, \
     simple_clock_bin_led_face_loop, \
     simple_clock_bin_led_face_resign, \
-    simple_clock_bin_led_face_wants_background_task, \
+    NULL, \
+    MOVEMENT_CONTEXT(simple_clock_bin_led_state_t), \
 })
 
 #endif // SIIMPLE_CLOCK_BIN_LED_FACE_H_
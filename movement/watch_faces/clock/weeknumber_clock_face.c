@@ -35,10 +35,9 @@ static void _update_alarm_indicator(bool settings_alarm_enabled, weeknumber_cloc
 
 void weeknumber_clock_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(weeknumber_clock_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(weeknumber_clock_state_t));
         weeknumber_clock_state_t *state = (weeknumber_clock_state_t *)*context_ptr;
         state->signal_enabled = false;
         state->watch_face_index = watch_face_index;
@@ -124,8 +123,13 @@ bool weeknumber_clock_face_loop(movement_event_t event, movement_settings_t *set
             break;
         case EVENT_ALARM_LONG_PRESS:
             state->signal_enabled = !state->signal_enabled;
-            if (state->signal_enabled) watch_set_indicator(WATCH_INDICATOR_BELL);
-            else watch_clear_indicator(WATCH_INDICATOR_BELL);
+            if (state->signal_enabled) {
+                watch_set_indicator(WATCH_INDICATOR_BELL);
+                movement_subscribe_background_task_for_face(state->watch_face_index, (movement_subscription_t){ .type = MOVEMENT_SUBSCRIBE_TOP_OF_HOUR });
+            } else {
+                watch_clear_indicator(WATCH_INDICATOR_BELL);
+                movement_unsubscribe_background_task_for_face(state->watch_face_index, (movement_subscription_t){ .type = MOVEMENT_SUBSCRIBE_TOP_OF_HOUR });
+            }
             break;
         case EVENT_BACKGROUND_TASK:
             // uncomment this line to snap back to the clock face when the hour signal sounds:
@@ -144,13 +148,3 @@ void weeknumber_clock_face_resign(movement_settings_t *settings, void *context)
     (void) settings;
     (void) context;
 }
-
-bool weeknumber_clock_face_wants_background_task(movement_settings_t *settings, void *context) {
-    (void) settings;
-    weeknumber_clock_state_t *state = (weeknumber_clock_state_t *)context;
-    if (!state->signal_enabled) return false;
-
-    watch_date_time date_time = watch_rtc_get_date_time();
-
-    return date_time.unit.minute == 0;
-}
@@ -48,14 +48,14 @@ void weeknumber_clock_face_setup(movement_settings_t *settings, uint8_t watch_fa
 void weeknumber_clock_face_activate(movement_settings_t *settings, void *context);
 bool weeknumber_clock_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
 void weeknumber_clock_face_resign(movement_settings_t *settings, void *context);
-bool weeknumber_clock_face_wants_background_task(movement_settings_t *settings, void *context);
 
 #define weeknumber_clock_face ((const watch_face_t){ \
     weeknumber_clock_face_setup, \
     weeknumber_clock_face_activate, \
     weeknumber_clock_face_loop, \
     weeknumber_clock_face_resign, \
-    weeknumber_clock_face_wants_background_task, \
+    NULL, \
+    MOVEMENT_CONTEXT(weeknumber_clock_state_t), \
 })
 
 #endif // SIMPLE_CLOCK_FACE_H_
@@ -124,10 +124,9 @@ static void beep_disable() {
 void world_clock2_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void **context_ptr)
 {
     (void) settings;
-    (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(world_clock2_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(world_clock2_state_t));
         memset(*context_ptr, 0, sizeof(world_clock2_state_t));
 
         /* Start in settings mode */
@@ -117,6 +117,7 @@ void world_clock2_face_resign(movement_settings_t *settings, void *context);
     world_clock2_face_loop, \
     world_clock2_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(world_clock2_state_t), \
 })
 
 #endif /* WORLD_CLOCK2_FACE_H_ */
@@ -92,9 +92,8 @@ static const int32_t clock_mapping[6][7][2] = {
 
 void wyoscan_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(wyoscan_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(wyoscan_state_t));
         memset(*context_ptr, 0, sizeof(wyoscan_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
     }
@@ -115,7 +114,9 @@ bool wyoscan_face_loop(movement_event_t event, movement_settings_t *settings, vo
     switch (event.event_type) {
         case EVENT_ACTIVATE:
             break;
-        case EVENT_TICK:            
+        case EVENT_TICK:
+            // each step of the scan goes out as one frame, so the display never catches it half drawn.
+            watch_display_begin_frame();
             if (!state->animate) {
                 date_time = watch_rtc_get_date_time();
                 state->start = 0; 
@@ -162,6 +163,7 @@ bool wyoscan_face_loop(movement_event_t event, movement_settings_t *settings, vo
                         state->illuminated_segments[state->end][1] = 99;
                         state->end = (state->end + 1) % MAX_ILLUMINATED_SEGMENTS;
                         state->animation = (state->animation + 1);
+                        watch_display_commit_frame();
                         break;
                     }
 
@@ -187,6 +189,7 @@ bool wyoscan_face_loop(movement_event_t event, movement_settings_t *settings, vo
                 }
                 state->animation = (state->animation + 1);
             } 
+            watch_display_commit_frame();
             break;
         case EVENT_LOW_ENERGY_UPDATE:
             break;
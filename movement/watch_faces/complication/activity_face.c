@@ -30,7 +30,6 @@
 #include <stdlib.h>
 #include <string.h>
 #include "activity_face.h"
-#include "chirpy_tx.h"
 #include "watch.h"
 #include "watch_utility.h"
 
@@ -103,56 +102,6 @@ static activity_item_t activity_log_buffer[ACTIVITY_LOG_SZ];
 // First two bytes chirped out, to identify transmission as from the activity face
 static const uint8_t activity_chirpy_prefix[CHIRPY_PREFIX_LEN] = {0x27, 0x00};
 
-// The face's different UI modes (views).
-typedef enum {
-    ACTM_CHOOSE = 0,
-    ACTM_LOGGING,
-    ACTM_PAUSED,
-    ACTM_DONE,
-    ACTM_LOGSIZE,
-    ACTM_CHIRP,
-    ACTM_CHIRPING,
-    ACTM_CLEAR,
-    ACTM_CLEAR_CONFIRM,
-    ACTM_CLEAR_DONE,
-} activity_mode_t;
-
-// The full state of the activity face
-typedef struct {
-    // Current mode (which secondary face, or ongoing operation like logging)
-    activity_mode_t mode;
-
-    // Index of currently selected activity in enabled_activities
-    uint8_t type_ix;
-
-    // Used for different things depending on mode
-    // In ACTM_DONE: countdown for animation, before returning to start face
-    // In ACTM_LOGGING and ACTM_PAUSED: drives blinking colon and alternating time display
-    // In ACTM_LOGSIZE, ACTM_CLEAR: enables timeout return to choose screen
-    uint16_t counter;
-
-    // Start of currently logged activity, if any
-    watch_date_time start_time;
-
-    // Total seconds elapsed since logging started
-    uint16_t curr_total_sec;
-
-    // Total paused seconds in current log
-    uint16_t curr_pause_sec;
-
-    // Helps us handle 1/64 ticks during transmission; including countdown timer
-    chirpy_tick_state_t chirpy_tick_state;
-
-    // Used by chirpy encoder during transmission
-    chirpy_encoder_state_t chirpy_encoder_state;
-
-    // 0: Running normally
-    // 1: In LE mode
-    // 2: Just woke up from LE mode. Will go to 0 after ignoring ALARM_BUTTON_UP.
-    uint8_t le_state;
-
-} activity_state_t;
-
 #define ACTIVITY_BUF_SZ 14
 
 // Temp buffer used for sprintf'ing content for the display.
@@ -174,9 +123,8 @@ static uint8_t _activity_get_next_byte(uint8_t *next_byte);
 
 void activity_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void **context_ptr) {
     (void)settings;
-    (void)watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(activity_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(activity_state_t));
         memset(*context_ptr, 0, sizeof(activity_state_t));
         // This happens only at boot
         _activity_clear_buffers();
@@ -196,12 +196,56 @@ static void _abort_quick_ticks(alarm_state_t *state) {
     }
 }
 
+static bool _alarm_is_due(alarm_state_t *state) {
+    watch_date_time now = watch_rtc_get_date_time();
+    for (uint8_t i = 0; i < ALARM_ALARMS; i++) {
+        if (state->alarm[i].enabled) {
+            if (state->alarm[i].minute == now.unit.minute) {
+                if (state->alarm[i].hour == now.unit.hour) {
+                    state->alarm_playing_idx = i;
+                    if (state->alarm[i].day == ALARM_DAY_EACH_DAY || state->alarm[i].day == ALARM_DAY_ONE_TIME) return true;
+                    uint8_t weekday_idx = _get_weekday_idx(now);
+                    if (state->alarm[i].day == weekday_idx) return true;
+                    if (state->alarm[i].day == ALARM_DAY_WORKDAY && weekday_idx < 5) return true;
+                    if (state->alarm[i].day == ALARM_DAY_WEEKEND && weekday_idx >= 5) return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+static void _alarm_update_subscription(alarm_state_t *state) {
+    // rather than being asked every minute, we have Movement wake us at the next time any alarm is set for, whatever
+    // its day; from there, we check the day and subscribe to the time after that. the signal indicator only changes
+    // at those times too, so that's when we update it.
+    watch_date_time now = watch_rtc_get_date_time();
+    uint16_t now_minutes_of_day = now.unit.hour * 60 + now.unit.minute;
+    uint16_t soonest = 0;
+    int16_t next_minutes_of_day = -1;
+
+    movement_unsubscribe_all_background_tasks_for_face(state->watch_face_index);
+    for (uint8_t i = 0; i < ALARM_ALARMS; i++) {
+        if (!state->alarm[i].enabled) continue;
+        uint16_t alarm_minutes_of_day = state->alarm[i].hour * 60 + state->alarm[i].minute;
+        // how long from now until it next comes around, from 1 minute to a whole day.
+        uint16_t minutes_until = (alarm_minutes_of_day + 24 * 60 - 1 - now_minutes_of_day) % (24 * 60) + 1;
+        if (next_minutes_of_day < 0 || minutes_until < soonest) {
+            soonest = minutes_until;
+            next_minutes_of_day = alarm_minutes_of_day;
+        }
+    }
+    if (next_minutes_of_day < 0) return;
+
+    movement_subscription_t next_alarm = { .type = MOVEMENT_SUBSCRIBE_AT_TIME, .hour = next_minutes_of_day / 60, .minute = next_minutes_of_day % 60 };
+    movement_subscribe_background_task_for_face(state->watch_face_index, next_alarm);
+}
+
 void alarm_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void **context_ptr) {
     (void) settings;
-    (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(alarm_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(alarm_state_t));
         alarm_state_t *state = (alarm_state_t *)*context_ptr;
         memset(*context_ptr, 0, sizeof(alarm_state_t));
         // initialize the default alarm values
@@ -210,7 +254,7 @@ void alarm_face_setup(movement_settings_t *settings, uint8_t watch_face_index, v
             state->alarm[i].beeps = 5;
             state->alarm[i].pitch = 1;
         }
-        state->alarm_handled_minute = -1;
+        state->watch_face_index = watch_face_index;
         _wait_ticks = -1;
     }
 }
@@ -225,40 +269,13 @@ void alarm_face_resign(movement_settings_t *settings, void *context) {
     alarm_state_t *state = (alarm_state_t *)context;
     state->is_setting = false;
     _alarm_update_alarm_enabled(settings, state);
+    _alarm_update_subscription(state);
     watch_set_led_off();
     state->alarm_quick_ticks = false;
     _wait_ticks = -1;
     movement_request_tick_frequency(1);
 }
 
-bool alarm_face_wants_background_task(movement_settings_t *settings, void *context) {
-    (void) settings;
-    alarm_state_t *state = (alarm_state_t *)context;
-    watch_date_time now = watch_rtc_get_date_time();
-    // just a failsafe: never fire more than one alarm within a minute
-    if (state->alarm_handled_minute == now.unit.minute) return false;
-    state->alarm_handled_minute = now.unit.minute;
-    // check the rest
-    for (uint8_t i = 0; i < ALARM_ALARMS; i++) {
-        if (state->alarm[i].enabled) {
-            if (state->alarm[i].minute == now.unit.minute) {
-                if (state->alarm[i].hour == now.unit.hour) {
-                    state->alarm_playing_idx = i;
-                    if (state->alarm[i].day == ALARM_DAY_EACH_DAY || state->alarm[i].day == ALARM_DAY_ONE_TIME) return true;
-                    uint8_t weekday_idx = _get_weekday_idx(now);
-                    if (state->alarm[i].day == weekday_idx) return true;
-                    if (state->alarm[i].day == ALARM_DAY_WORKDAY && weekday_idx < 5) return true;
-                    if (state->alarm[i].day == ALARM_DAY_WEEKEND && weekday_idx >= 5) return true;
-                }
-            }
-        }
-    }
-    state->alarm_handled_minute = -1;
-    // update the movement's alarm indicator five times an hour
-    if (now.unit.minute % 12 == 0) _alarm_update_alarm_enabled(settings, state);
-    return false;
-}
-
 bool alarm_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
     (void) settings;
     alarm_state_t *state = (alarm_state_t *)context;
@@ -281,7 +298,7 @@ bool alarm_face_loop(movement_event_t event, movement_settings_t *settings, void
                     // revert change of enabled flag and show it briefly
                     state->alarm[state->alarm_idx].enabled ^= 1;
                     _alarm_set_signal(state);
-                    delay_ms(275);
+                    watch_delay_ms(275);
                     state->alarm_idx = 0;
                 }
             } else break; // no need to do anything when we are not in settings mode and no quick ticks are running
@@ -388,6 +405,12 @@ bool alarm_face_loop(movement_event_t event, movement_settings_t *settings, void
         } else _wait_ticks = -1;
         break;
     case EVENT_BACKGROUND_TASK:
+        // Movement wakes us at each time an alarm is set for, but it may not be that alarm's day.
+        if (!_alarm_is_due(state)) {
+            _alarm_update_alarm_enabled(settings, state);
+            _alarm_update_subscription(state);
+            break;
+        }
         // play alarm
         if (state->alarm[state->alarm_playing_idx].beeps == 0) {
             // short beep
@@ -411,8 +434,9 @@ bool alarm_face_loop(movement_event_t event, movement_settings_t *settings, void
             state->alarm[state->alarm_playing_idx].beeps = 5;
             state->alarm[state->alarm_playing_idx].pitch = 1;
             state->alarm[state->alarm_playing_idx].enabled = false;
-            _alarm_update_alarm_enabled(settings, state);
         }
+        _alarm_update_alarm_enabled(settings, state);
+        _alarm_update_subscription(state);
         break;
     case EVENT_TIMEOUT:
         movement_move_to_face(0);
@@ -78,7 +78,7 @@ typedef struct {
     uint8_t alarm_idx : 4;
     uint8_t alarm_playing_idx : 4;
     uint8_t setting_state : 3;
-    int8_t alarm_handled_minute;
+    uint8_t watch_face_index;
     bool alarm_quick_ticks : 1;
     bool is_setting : 1;
     alarm_setting_t alarm[ALARM_ALARMS];
@@ -89,14 +89,14 @@ void alarm_face_setup(movement_settings_t *settings, uint8_t watch_face_index, v
 void alarm_face_activate(movement_settings_t *settings, void *context);
 bool alarm_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
 void alarm_face_resign(movement_settings_t *settings, void *context);
-bool alarm_face_wants_background_task(movement_settings_t *settings, void *context);
 
 #define alarm_face ((const watch_face_t){ \
     alarm_face_setup, \
     alarm_face_activate, \
     alarm_face_loop, \
     alarm_face_resign, \
-    alarm_face_wants_background_task, \
+    NULL, \
+    MOVEMENT_CONTEXT(alarm_state_t), \
 })
 
 #endif // ALARM_FACE_H_
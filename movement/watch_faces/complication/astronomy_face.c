@@ -190,9 +190,8 @@ static void _astronomy_face_update(movement_event_t event, movement_settings_t *
 
 void astronomy_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(astronomy_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(astronomy_state_t));
         memset(*context_ptr, 0, sizeof(astronomy_state_t));
     }
 }
@@ -38,6 +38,11 @@
 
 #include "movement.h"
 
+typedef struct {
+    uint8_t current_stage;
+    bool sound_on;
+} breathing_state_t;
+
 void breathing_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void breathing_face_activate(movement_settings_t *settings, void *context);
 bool breathing_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
@@ -49,6 +54,7 @@ void breathing_face_resign(movement_settings_t *settings, void *context);
     breathing_face_loop, \
     breathing_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(breathing_state_t), \
 })
 
 #endif // BREATHING_FACE_H_
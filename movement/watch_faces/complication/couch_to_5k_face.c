@@ -124,9 +124,8 @@ static void _display(couch_to_5k_state_t *state, char *buf){
 void couch_to_5k_face_setup(movement_settings_t *settings, uint8_t
                           watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(couch_to_5k_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(couch_to_5k_state_t));
         memset(*context_ptr, 0, sizeof(couch_to_5k_state_t));
         // Do any one-time tasks in here; the inside of this conditional
         // happens only at boot.
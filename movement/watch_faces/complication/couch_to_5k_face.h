@@ -81,6 +81,7 @@ void couch_to_5k_face_resign(movement_settings_t *settings, void *context);
     couch_to_5k_face_loop, \
     couch_to_5k_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(couch_to_5k_state_t), \
 })
 
 #endif // COUCHTO5K_FACE_H_
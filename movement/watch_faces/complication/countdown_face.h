@@ -76,6 +76,7 @@ void countdown_face_resign(movement_settings_t *settings, void *context);
     countdown_face_loop, \
     countdown_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(countdown_state_t), \
 })
 
 #endif // COUNTDOWN_FACE_H_
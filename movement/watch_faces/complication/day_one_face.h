@@ -78,6 +78,7 @@ void day_one_face_resign(movement_settings_t *settings, void *context);
     day_one_face_loop, \
     day_one_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(day_one_state_t), \
 })
 
 #endif // DAY_ONE_FACE_H_
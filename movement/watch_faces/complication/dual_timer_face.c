@@ -44,6 +44,9 @@
 #if __EMSCRIPTEN__
 #include <emscripten.h>
 #include <emscripten/html5.h>
+#include "watch_main_loop.h"
+#elif defined(WATCH_HOST)
+#include "watch_host.h"
 #else
 #include "../../../watch-library/hardware/include/saml22j18a.h"
 #include "../../../watch-library/hardware/include/component/tc.h"
@@ -56,7 +59,7 @@ static uint32_t _ticks;
 
 #if __EMSCRIPTEN__
 
-static long _em_interval_id = 0;
+static int8_t _em_interval_id = -1;
 
 void em_dual_timer_cb_handler(void *userData) {
     // interrupt handler for emscripten 128 Hz callbacks
@@ -67,14 +70,38 @@ void em_dual_timer_cb_handler(void *userData) {
 static void _dual_timer_cb_initialize() { }
 
 static inline void _dual_timer_cb_stop() {
-    emscripten_clear_interval(_em_interval_id);
-    _em_interval_id = 0;
+    main_loop_clear_timer(_em_interval_id);
+    _em_interval_id = -1;
     _is_running = false;
 }
 
 static inline void _dual_timer_cb_start() {
     // initiate 128 hz callback
-    _em_interval_id = emscripten_set_interval(em_dual_timer_cb_handler, (double)(1000/128), (void *)NULL);
+    _em_interval_id = main_loop_set_peripheral_timer(em_dual_timer_cb_handler, NULL, 1000.0 / 128, 1000.0 / 128);
+}
+
+#elif defined(WATCH_HOST)
+
+static int8_t _host_timer_id = -1;
+
+static void _dual_timer_host_cb_handler(void *userData) {
+    // stands in for the TC2 overflow interrupt at 128 Hz of virtual time
+    (void) userData;
+    _ticks++;
+}
+
+static void _dual_timer_cb_initialize(void) { }
+
+static inline void _dual_timer_cb_stop(void) {
+    watch_host_clear_timer(_host_timer_id);
+    _host_timer_id = -1;
+    _is_running = false;
+}
+
+static inline void _dual_timer_cb_start(void) {
+    const uint64_t period = WATCH_HOST_NSEC_PER_SEC / 128;
+    _host_timer_id = watch_host_set_timer(_dual_timer_host_cb_handler, NULL, period, period);
+    _is_running = true;
 }
 
 #else
@@ -207,6 +234,9 @@ static void dual_timer_display(dual_timer_state_t *state) {
         sprintf(buf, "%02u%02u%02u", timer.hours, timer.minutes, timer.seconds);
     else
         sprintf(buf, "%02u%02u%02u", timer.minutes, timer.seconds, timer.centiseconds);
+
+    // this runs at 16 Hz while a timer is going; draw it all as one frame.
+    watch_display_begin_frame();
     watch_display_string(buf, 4);
     
     // which counter is displayed
@@ -222,15 +252,15 @@ static void dual_timer_display(dual_timer_state_t *state) {
     // blink colon when running
     if ( timer.centiseconds > 50 || !state->running[state->show] ) watch_set_colon();
     else watch_clear_colon();
+    watch_display_commit_frame();
 }
 
 // PUBLIC WATCH FACE FUNCTIONS ////////////////////////////////////////////////
 
 void dual_timer_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(dual_timer_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(dual_timer_state_t));
         memset(*context_ptr, 0, sizeof(dual_timer_state_t));
         _ticks = 0;
     }
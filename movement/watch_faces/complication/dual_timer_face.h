@@ -102,6 +102,7 @@ void TC2_Handler(void);
     dual_timer_face_loop, \
     dual_timer_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(dual_timer_state_t), \
 })
 
 #endif // DUAL_TIMER_FACE_H_
@@ -28,9 +28,8 @@
 
 void flashlight_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(flashlight_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(flashlight_state_t));
         memset(*context_ptr, 0, sizeof(flashlight_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
     }
@@ -53,6 +53,7 @@ void flashlight_face_resign(movement_settings_t *settings, void *context);
     flashlight_face_loop, \
     flashlight_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(flashlight_state_t), \
 })
 
 #endif // FLASHLIGHT_FACE_H_
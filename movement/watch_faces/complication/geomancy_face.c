@@ -72,10 +72,9 @@ static void _throw_animation(geomancy_state_t *state);
 // WATCH FACE FUNCTIONS ///////////////////////////////////////////////////////
 
 void geomancy_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
-    (void) watch_face_index;
     (void) settings;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(geomancy_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(geomancy_state_t));
         memset(*context_ptr, 0, sizeof(geomancy_state_t));
     }
 }
@@ -153,6 +152,8 @@ void geomancy_face_resign(movement_settings_t *settings, void *context) {
 static void geomancy_face_display(geomancy_state_t *state) {
     char token[7] = {0};
     nibble_t figure = *((nibble_t*) &state->geomantic_figure);
+    // the throw animation runs at 16 Hz; each step of it goes out as one frame.
+    watch_display_begin_frame();
     switch ( state->mode ) {
         case 0:
             watch_display_string("    IChing", 0);
@@ -185,6 +186,7 @@ static void geomancy_face_display(geomancy_state_t *state) {
         default:
             break;
     }
+    watch_display_commit_frame();
 }
 
 /** @brief screen clearing animation between castings */
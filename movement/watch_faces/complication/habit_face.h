@@ -36,6 +36,13 @@
 
 #include "movement.h"
 
+typedef struct {
+  uint16_t total_count;
+  uint8_t lookback;
+  uint32_t last_update;
+  bool display_total;
+} habit_state_t;
+
 void habit_face_setup(movement_settings_t *settings, uint8_t watch_face_index,
                       void **context_ptr);
 void habit_face_activate(movement_settings_t *settings, void *context);
@@ -48,6 +55,7 @@ void habit_face_resign(movement_settings_t *settings, void *context);
     habit_face_loop, \
     habit_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(habit_state_t), \
 })
 
 #endif // HABIT_FACE_H_
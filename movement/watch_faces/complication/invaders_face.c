@@ -205,9 +205,8 @@ static bool _move_invaders() {
 
 void invaders_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(invaders_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(invaders_state_t));
         memset(*context_ptr, 0, sizeof(invaders_state_t));
         invaders_state_t *state = (invaders_state_t *)*context_ptr;
         // default: sound on
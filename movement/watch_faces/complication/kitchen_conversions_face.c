@@ -95,10 +95,9 @@ static void reset_state(kitchen_conversions_state_t *state, movement_settings_t
 void kitchen_conversions_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void **context_ptr)
 {
     (void)settings;
-    (void)watch_face_index;
     if (*context_ptr == NULL)
     {
-        *context_ptr = malloc(sizeof(kitchen_conversions_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(kitchen_conversions_state_t));
         memset(*context_ptr, 0, sizeof(kitchen_conversions_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
     }
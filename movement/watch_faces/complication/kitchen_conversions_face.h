@@ -81,7 +81,8 @@ void kitchen_conversions_face_resign(movement_settings_t *settings, void *contex
     kitchen_conversions_face_activate,                  \
     kitchen_conversions_face_loop,                      \
     kitchen_conversions_face_resign,                    \
-    NULL,                                               \
+    NULL, \
+    MOVEMENT_CONTEXT(kitchen_conversions_state_t), \
 })
 
 #endif // KITCHEN_CONVERSIONS_FACE_H_
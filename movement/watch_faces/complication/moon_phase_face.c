@@ -43,9 +43,8 @@ static const float phase_changes[] = {0, 1, 6.38264692644, 8.38264692644, 13.765
 
 void moon_phase_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(moon_phase_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(moon_phase_state_t));
         memset(*context_ptr, 0, sizeof(moon_phase_state_t));
     }
 }
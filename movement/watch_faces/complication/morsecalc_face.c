@@ -108,9 +108,8 @@ void morsecalc_input(morsecalc_state_t * mcs) {
 
 void morsecalc_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(morsecalc_state_t)); 
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(morsecalc_state_t)); 
         morsecalc_state_t *mcs = (morsecalc_state_t *)*context_ptr;
         morsecalc_reset_token(mcs); 
         
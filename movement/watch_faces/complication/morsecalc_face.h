@@ -158,6 +158,7 @@ void morsecalc_input(morsecalc_state_t *mcs);
     morsecalc_face_loop, \
     morsecalc_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(morsecalc_state_t), \
 })
 
 #endif // MORSECALC_FACE_H_
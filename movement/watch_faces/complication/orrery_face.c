@@ -151,9 +151,8 @@ static void _orrery_face_update(movement_event_t event, movement_settings_t *set
 
 void orrery_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(orrery_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(orrery_state_t));
         memset(*context_ptr, 0, sizeof(orrery_state_t));
     }
 }
@@ -103,6 +103,7 @@ void planetary_hours_face_resign(movement_settings_t *settings, void *context);
     planetary_hours_face_loop, \
     planetary_hours_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(planetary_hours_state_t), \
 })
 
 #endif // planetary_hours_face_H_
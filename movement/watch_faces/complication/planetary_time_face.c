@@ -271,10 +271,9 @@ static void _planetary_time(movement_event_t event, movement_settings_t *setting
 // PUBLIC WATCH FACE FUNCTIONS ////////////////////////////////////////////////
 
 void planetary_time_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
-    (void) watch_face_index;
     (void) settings;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(planetary_time_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(planetary_time_state_t));
         memset(*context_ptr, 0, sizeof(planetary_time_state_t));
     }
 }
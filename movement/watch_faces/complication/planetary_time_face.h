@@ -104,6 +104,7 @@ void planetary_time_face_resign(movement_settings_t *settings, void *context);
     planetary_time_face_loop, \
     planetary_time_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(planetary_time_state_t), \
 })
 
 #endif // planetary_time_face_H_
@@ -106,9 +106,8 @@ static void display_dice_roll_animation(probability_state_t *state) {
 // ---------------------------
 void probability_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(probability_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(probability_state_t));
         memset(*context_ptr, 0, sizeof(probability_state_t));
     }
     // Emulator only: Seed random number generator
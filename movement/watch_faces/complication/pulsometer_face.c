@@ -51,13 +51,6 @@
 
 #define PULSOMETER_FACE_FREQUENCY (1 << PULSOMETER_FACE_FREQUENCY_FACTOR)
 
-typedef struct {
-    bool measuring;
-    int16_t pulses;
-    int16_t ticks;
-    int8_t calibration;
-} pulsometer_state_t;
-
 static void pulsometer_display_title(pulsometer_state_t *pulsometer) {
     watch_display_string(PULSOMETER_FACE_TITLE, 0);
 }
@@ -135,10 +128,9 @@ static void pulsometer_cycle_calibration(pulsometer_state_t *pulsometer, int8_t
 
 void pulsometer_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        pulsometer_state_t *pulsometer = malloc(sizeof(pulsometer_state_t));
+        pulsometer_state_t *pulsometer = movement_claim_context(watch_face_index, sizeof(pulsometer_state_t));
 
         pulsometer->calibration = PULSOMETER_FACE_CALIBRATION_DEFAULT;
         pulsometer->pulses = 0;
@@ -71,6 +71,13 @@
 
 #include "movement.h"
 
+typedef struct {
+    bool measuring;
+    int16_t pulses;
+    int16_t ticks;
+    int8_t calibration;
+} pulsometer_state_t;
+
 void pulsometer_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void pulsometer_face_activate(movement_settings_t *settings, void *context);
 bool pulsometer_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
@@ -82,6 +89,7 @@ void pulsometer_face_resign(movement_settings_t *settings, void *context);
     pulsometer_face_loop, \
     pulsometer_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(pulsometer_state_t), \
 })
 
 #endif // PULSOMETER_FACE_H_
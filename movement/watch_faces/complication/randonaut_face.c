@@ -23,7 +23,7 @@
  */
 
 // Emulator only: need time() to seed the random number generator.
-#if __EMSCRIPTEN__
+#if defined(__EMSCRIPTEN__) || defined(WATCH_HOST)
 #include <time.h>
 #else
 #include "saml22j18a.h"
@@ -52,9 +52,8 @@ static void _get_entropy(randonaut_state_t *state);
 
 void randonaut_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(randonaut_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(randonaut_state_t));
         memset(*context_ptr, 0, sizeof(randonaut_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
     }
@@ -228,7 +227,7 @@ static void _randonaut_face_display(randonaut_state_t *state) {
                     if ( c < 50 ) { 
                         watch_clear_pixel(_get_pseudo_entropy(0x2),_get_pseudo_entropy(14+9));
                     }
-                    delay_ms(_get_pseudo_entropy(c)+20);
+                    watch_delay_ms(_get_pseudo_entropy(c)+20);
                     if ( c < 30 ) {
                         watch_display_string(" ",_get_pseudo_entropy(10));
                     }
@@ -250,7 +249,7 @@ static void _randonaut_face_display(randonaut_state_t *state) {
                     watch_display_string("0", _get_pseudo_entropy(10));
                     watch_display_string("11", _get_pseudo_entropy(10));
                     watch_display_string("00", _get_pseudo_entropy(10));
-                    delay_ms(50);
+                    watch_delay_ms(50);
                     watch_display_string(" ", _get_pseudo_entropy(10));
                     watch_display_string(" ", _get_pseudo_entropy(10));
                     watch_display_string(" ", _get_pseudo_entropy(10));
@@ -261,7 +260,7 @@ static void _randonaut_face_display(randonaut_state_t *state) {
             state->face.mode = 2; // point
             state->face.location_format = 1; // distance
             watch_display_string("RA   Found", 0);
-            delay_ms(500);
+            watch_delay_ms(500);
             sprintf(buf, "RA   Found");
             break;
         case 2: //point
@@ -349,7 +348,7 @@ static uint32_t _get_pseudo_entropy(uint32_t max) {
 /** @brief true random number generator
  */
 static uint32_t _get_true_entropy(void) {
-    #if __EMSCRIPTEN__
+    #if defined(__EMSCRIPTEN__) || defined(WATCH_HOST)
     return rand() % INT32_MAX;
     #else
     hri_mclk_set_APBCMASK_TRNG_bit(MCLK);
@@ -386,12 +385,12 @@ static void _save_point_to_file(randonaut_state_t *state) {
     place.latitude = state->point.latitude;
     place.longitude = state->point.longitude;
     if (filesystem_write_file("place.loc", (char*)&place, sizeof(place))) {
-        delay_ms(100);
+        watch_delay_ms(100);
         watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
     } else {
         watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
         watch_set_indicator(WATCH_INDICATOR_BELL);
-        delay_ms(500);
+        watch_delay_ms(500);
         watch_clear_indicator(WATCH_INDICATOR_BELL);
         
     }
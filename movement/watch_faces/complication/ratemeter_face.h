@@ -53,6 +53,7 @@ void ratemeter_face_resign(movement_settings_t *settings, void *context);
     ratemeter_face_loop, \
     ratemeter_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(ratemeter_state_t), \
 })
 
 #endif // RATEMETER_FACE_H_
@@ -32,10 +32,9 @@ static void show_fn(calculator_state_t *state, uint8_t subsecond);
 
 void rpn_calculator_alt_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(calculator_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(calculator_state_t));
         memset(*context_ptr, 0, sizeof(calculator_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
     }
@@ -90,6 +90,7 @@ void rpn_calculator_alt_face_resign(movement_settings_t *settings, void *context
     rpn_calculator_alt_face_loop, \
     rpn_calculator_alt_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(calculator_state_t), \
 })
 
 #endif // CALCULATOR_FACE_H_
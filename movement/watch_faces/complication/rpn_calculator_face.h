@@ -75,6 +75,7 @@ void rpn_calculator_face_resign(movement_settings_t *settings, void *context);
     rpn_calculator_face_loop, \
     rpn_calculator_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(rpn_calculator_state_t), \
 })
 
 #endif // RPN_CALCULATOR_FACE_H_
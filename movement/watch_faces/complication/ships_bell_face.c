@@ -63,10 +63,9 @@ static void ships_bell_draw(ships_bell_state_t *state) {
 
 void ships_bell_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void **context_ptr) {
     (void) settings;
-    (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(ships_bell_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(ships_bell_state_t));
         memset(*context_ptr, 0, sizeof(ships_bell_state_t));
     }
 }
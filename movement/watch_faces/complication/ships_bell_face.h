@@ -63,6 +63,7 @@ bool ships_bell_face_wants_background_task(movement_settings_t *settings, void *
     ships_bell_face_loop, \
     ships_bell_face_resign, \
     ships_bell_face_wants_background_task, \
+    MOVEMENT_CONTEXT(ships_bell_state_t), \
 })
 
 #endif // SHIPS_BELL_FACE_H_
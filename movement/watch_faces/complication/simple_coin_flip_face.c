@@ -22,7 +22,7 @@
  * SOFTWARE.
  */
 
-#if __EMSCRIPTEN__
+#if defined(__EMSCRIPTEN__) || defined(WATCH_HOST)
 #include <time.h>
 #else
 #include "saml22j18a.h"
@@ -36,9 +36,8 @@
 
 void simple_coin_flip_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(simple_coin_flip_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(simple_coin_flip_state_t));
         memset(*context_ptr, 0, sizeof(simple_coin_flip_state_t));
     }
 }
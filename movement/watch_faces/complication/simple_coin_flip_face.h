@@ -56,6 +56,7 @@ void simple_coin_flip_face_resign(movement_settings_t *settings, void *context);
     simple_coin_flip_face_loop, \
     simple_coin_flip_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(simple_coin_flip_state_t), \
 })
 
 #endif // SIMPLE_COIN_FLIP_FACE_H_
@@ -131,9 +131,8 @@ static void calculate_datetimes(solstice_state_t *state, movement_settings_t *se
 
 void solstice_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(solstice_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(solstice_state_t));
         solstice_state_t *state = (solstice_state_t *)*context_ptr;
 
         watch_date_time now = watch_rtc_get_date_time();
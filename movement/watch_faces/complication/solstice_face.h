@@ -58,6 +58,7 @@ void solstice_face_resign(movement_settings_t *settings, void *context);
     solstice_face_loop, \
     solstice_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(solstice_state_t), \
 })
 
 #endif // SOLSTICE_FACE_H_
@@ -42,6 +42,7 @@
 #if __EMSCRIPTEN__
 #include <emscripten.h>
 #include <emscripten/html5.h>
+#include "watch_main_loop.h"
 #else
 #include "../../../watch-library/hardware/include/saml22j18a.h"
 #include "../../../watch-library/hardware/include/component/tc.h"
@@ -64,7 +65,7 @@ static bool _is_running;
 
 #if __EMSCRIPTEN__
 
-static long _em_interval_id = 0;
+static int8_t _em_interval_id = -1;
 
 void em_cb_handler(void *userData) {
     // interrupt handler for emscripten 128 Hz callbacks
@@ -75,14 +76,14 @@ void em_cb_handler(void *userData) {
 static void _cb_initialize() { }
 
 static inline void _cb_stop() {
-    emscripten_clear_interval(_em_interval_id);
-    _em_interval_id = 0;
+    main_loop_clear_timer(_em_interval_id);
+    _em_interval_id = -1;
     _is_running = false;
 }
 
 static inline void _cb_start() {
     // initiate 128 hz callback
-    _em_interval_id = emscripten_set_interval(em_cb_handler, (double)(1000/128), (void *)NULL);
+    _em_interval_id = main_loop_set_peripheral_timer(em_cb_handler, NULL, 1000.0 / 128, 1000.0 / 128);
 }
 
 #else
@@ -204,9 +205,8 @@ static inline void _set_colon() {
 
 void stock_stopwatch_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(stock_stopwatch_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(stock_stopwatch_state_t));
         memset(*context_ptr, 0, sizeof(stock_stopwatch_state_t));
         stock_stopwatch_state_t *state = (stock_stopwatch_state_t *)*context_ptr;
         _ticks = _lap_ticks = _blink_ticks = _old_minutes = _old_seconds = _hours = 0;
@@ -75,6 +75,7 @@ void TC2_Handler(void);
     stock_stopwatch_face_loop, \
     stock_stopwatch_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(stock_stopwatch_state_t), \
 })
 
 #endif // STOCK_STOPWATCH_FACE_H_
@@ -37,9 +37,8 @@ static const watch_date_time distant_future = {
 
 void stopwatch_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(stopwatch_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(stopwatch_state_t));
         memset(*context_ptr, 0, sizeof(stopwatch_state_t));
     }
 }
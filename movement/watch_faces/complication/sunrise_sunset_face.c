@@ -285,9 +285,8 @@ static void _sunrise_sunset_face_advance_digit(sunrise_sunset_state_t *state) {
 
 void sunrise_sunset_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(sunrise_sunset_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(sunrise_sunset_state_t));
         memset(*context_ptr, 0, sizeof(sunrise_sunset_state_t));
     }
 }
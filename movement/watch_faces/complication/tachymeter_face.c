@@ -40,9 +40,8 @@ static uint32_t _distance_from_struct(distance_digits_t dist_digits) {
 
 void tachymeter_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void)settings;
-    (void)watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(tachymeter_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(tachymeter_state_t));
         memset(*context_ptr, 0, sizeof(tachymeter_state_t));
         tachymeter_state_t *state = (tachymeter_state_t *)*context_ptr;
         // Default distance
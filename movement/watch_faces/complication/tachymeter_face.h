@@ -103,6 +103,7 @@ void tachymeter_face_resign(movement_settings_t *settings, void *context);
     tachymeter_face_loop, \
     tachymeter_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(tachymeter_state_t), \
 })
 
 #endif // TACHYMETER_FACE_H_
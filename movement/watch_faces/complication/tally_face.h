@@ -55,6 +55,7 @@ void print_tally(tally_state_t *state);
     tally_face_loop, \
     tally_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(tally_state_t), \
 })
 
 #endif // TALLY_FACE_H_
@@ -210,9 +210,8 @@ static void display_animation(tarot_state_t *state) {
 // ---------------------------
 void tarot_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(tarot_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(tarot_state_t));
         memset(*context_ptr, 0, sizeof(tarot_state_t));
     }
     // Emulator only: Seed random number generator
@@ -84,6 +84,7 @@ void tarot_face_resign(movement_settings_t *settings, void *context);
     tarot_face_loop, \
     tarot_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(tarot_state_t), \
 })
 
 #endif // TAROT_FACE_H_
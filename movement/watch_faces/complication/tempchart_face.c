@@ -42,10 +42,11 @@ static void tempchart_save(void) {
 
 void tempchart_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     // These next two lines just silence the compiler warnings associated with unused parameters.
-    // We have no use for the settings or the watch_face_index, so we make that explicit here.
+    // We have no use for the settings, so we make that explicit here.
     (void) settings;
     (void) context_ptr;
-    (void) watch_face_index;
+    // Updating data every 5 minutes
+    movement_subscribe_background_task_for_face(watch_face_index, (movement_subscription_t){ .type = MOVEMENT_SUBSCRIBE_EVERY_N_MINUTES, .minute = 5 });
     // At boot, context_ptr will be NULL indicating that we don't have anyplace to store our context.
     if (filesystem_get_file_size("tempchart.ini") != sizeof(tempchart_state)) {
         // No previous ini or old version of ini file - create new config file
@@ -135,13 +136,3 @@ void tempchart_face_resign(movement_settings_t *settings, void *context) {
     (void) settings;
     (void) context;
 }
-
-//background freq correction
-bool tempchart_face_wants_background_task(movement_settings_t *settings, void *context) {
-    (void) settings;
-    (void) context;
-    watch_date_time date_time = watch_rtc_get_date_time();
-
-    //Updating data every 5 minutes
-    return date_time.unit.minute % 5 == 0;
-}
@@ -44,7 +44,6 @@ void tempchart_face_setup(movement_settings_t *settings, uint8_t watch_face_inde
 void tempchart_face_activate(movement_settings_t *settings, void *context);
 bool tempchart_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
 void tempchart_face_resign(movement_settings_t *settings, void *context);
-bool tempchart_face_wants_background_task(movement_settings_t *settings, void *context);
 
 
 #define tempchart_face ((const watch_face_t){ \
@@ -52,7 +51,8 @@ bool tempchart_face_wants_background_task(movement_settings_t *settings, void *c
     tempchart_face_activate, \
     tempchart_face_loop, \
     tempchart_face_resign, \
-    tempchart_face_wants_background_task, \
+    NULL, \
+    MOVEMENT_NO_CONTEXT, \
 })
 
 #endif // TEMPCHART_FACE_H_
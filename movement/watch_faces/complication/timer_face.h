@@ -97,6 +97,7 @@ void timer_face_resign(movement_settings_t *settings, void *context);
     timer_face_loop, \
     timer_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(timer_state_t), \
 })
 
 
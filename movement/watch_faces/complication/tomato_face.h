@@ -78,6 +78,7 @@ void tomato_face_resign(movement_settings_t *settings, void *context);
     tomato_face_loop, \
     tomato_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(tomato_state_t), \
 })
 
 #endif // TOMATO_FACE_H_
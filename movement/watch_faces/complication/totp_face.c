@@ -163,12 +163,11 @@ static inline uint32_t totp_compute_base_timestamp(movement_settings_t *settings
 
 void totp_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
 
     totp_validate_key_lengths();
 
     if (*context_ptr == NULL) {
-        totp_state_t *totp = malloc(sizeof(totp_state_t));
+        totp_state_t *totp = movement_claim_context(watch_face_index, sizeof(totp_state_t));
         totp->current_decoded_key = malloc(TOTP_FACE_MAX_KEY_LENGTH);
         *context_ptr = totp;
     }
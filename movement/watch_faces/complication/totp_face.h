@@ -85,6 +85,7 @@ void totp_face_resign(movement_settings_t *settings, void *context);
     totp_face_loop, \
     totp_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(totp_state_t), \
 })
 
 #endif // TOTP_FACE_H_
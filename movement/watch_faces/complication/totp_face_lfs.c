@@ -120,14 +120,14 @@ static void totp_face_lfs_read_file(char *filename) {
     // For 'format' of file, see comment at top.
     const size_t uri_start_len = strlen(TOTP_URI_START);
 
-    if (!filesystem_file_exists(filename)) {
+    filesystem_line_reader_t reader;
+    if (!filesystem_line_reader_open(&reader, filename)) {
         printf("TOTP file error: %s\n", filename);
         return;
     }
 
     char line[256];
-    int32_t offset = 0;
-    while (filesystem_read_line(filename, line, &offset, 255) && strlen(line)) {
+    while (filesystem_line_reader_next(&reader, line, 255) && strlen(line)) {
         if (num_totp_records == MAX_TOTP_RECORDS) {
             printf("TOTP max records: %d\n", MAX_TOTP_RECORDS);
             break;
@@ -170,13 +170,14 @@ static void totp_face_lfs_read_file(char *filename) {
             printf("TOTP missing secret: %s\n", line);
         }
     }
+
+    filesystem_line_reader_close(&reader);
 }
 
 void totp_face_lfs_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(totp_lfs_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(totp_lfs_state_t));
     }
 
 #if !(__EMSCRIPTEN__)
@@ -71,6 +71,7 @@ void totp_face_lfs_resign(movement_settings_t *settings, void *context);
     totp_face_lfs_loop, \
     totp_face_lfs_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(totp_lfs_state_t), \
 })
 
 #endif // TOTP_FACE_LFS_H_
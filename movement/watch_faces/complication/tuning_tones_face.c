@@ -66,9 +66,8 @@ static void draw(tuning_tones_state_t *state)
 
 void tuning_tones_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
     if (*context_ptr == NULL) {
-        tuning_tones_state_t *state = malloc(sizeof *state);
+        tuning_tones_state_t *state = movement_claim_context(watch_face_index, sizeof *state);
         memset(state, 0, sizeof *state);
         state->note_ind = 9;
         *context_ptr = state;
@@ -51,6 +51,7 @@ void tuning_tones_face_resign(movement_settings_t *settings, void *context);
     tuning_tones_face_loop, \
     tuning_tones_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(tuning_tones_state_t), \
 })
 
 #endif // TUNING_TONES_FACE_H_
@@ -32,6 +32,15 @@
 // Private
 //
 
+static
+void _wake_face_update_subscription(wake_face_state_t *state) {
+    movement_unsubscribe_all_background_tasks_for_face(state->watch_face_index);
+    if ( state->mode ) {
+        movement_subscription_t wake_time = { .type = MOVEMENT_SUBSCRIBE_AT_TIME, .hour = state->hour, .minute = state->minute };
+        movement_subscribe_background_task_for_face(state->watch_face_index, wake_time);
+    }
+}
+
 static
 void _wake_face_update_display(movement_settings_t *settings, wake_face_state_t *state) {
     (void) settings;
@@ -62,16 +71,16 @@ void _wake_face_update_display(movement_settings_t *settings, wake_face_state_t
 
 void wake_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void **context_ptr) {
     (void) settings;
-    (void) watch_face_index;
 
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(wake_face_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(wake_face_state_t));
         wake_face_state_t *state = (wake_face_state_t *)*context_ptr;
         memset(*context_ptr, 0, sizeof(wake_face_state_t));
 
         state->hour = 5;
         state->minute = 0;
         state->mode = 0;
+        state->watch_face_index = watch_face_index;
     }
 }
 
@@ -84,25 +93,6 @@ void wake_face_resign(movement_settings_t *settings, void *context) {
     (void) context;
 }
 
-bool wake_face_wants_background_task(movement_settings_t *settings, void *context) {
-    (void) settings;
-    wake_face_state_t *state = (wake_face_state_t *)context;
-
-    bool rc = false;
-    if ( state->mode ) {
-        watch_date_time now = watch_rtc_get_date_time();
-        rc = state->hour==now.unit.hour && state->minute==now.unit.minute;
-        // We’re at the mercy of the wants_background_task handler
-        // In Safari, the emulator triggers at the ›end‹ of the minute
-        // Converting to Unix timestamps and taking a difference between now and wake
-        // is not an easy win — because the timestamp for wake has to rely on now
-        // for its date. So first we’d have to see if the TOD of wake is after that
-        // of now. If it is, take tomorrow’s date, calculating month and year rollover
-        // if need be.
-    }
-    return rc;
-}
-
 bool wake_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
     (void) settings;
     wake_face_state_t *state = (wake_face_state_t *)context;
@@ -114,18 +104,22 @@ bool wake_face_loop(movement_event_t event, movement_settings_t *settings, void
         break;
     case EVENT_LIGHT_BUTTON_UP:
         state->hour = (state->hour + 1) % 24;
+        _wake_face_update_subscription(state);
         _wake_face_update_display(settings, state);
         break;
     case EVENT_LIGHT_LONG_PRESS:
         state->hour = (state->hour + 6) % 24;
+        _wake_face_update_subscription(state);
         _wake_face_update_display(settings, state);
         break;
     case EVENT_ALARM_BUTTON_UP:
         state->minute = (state->minute + 10) % 60;
+        _wake_face_update_subscription(state);
         _wake_face_update_display(settings, state);
         break;
     case EVENT_ALARM_LONG_PRESS:
         state->mode ^= 1;
+        _wake_face_update_subscription(state);
         _wake_face_update_display(settings, state);
         break;
     case EVENT_BACKGROUND_TASK:
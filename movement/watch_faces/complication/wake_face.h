@@ -46,20 +46,21 @@ typedef struct {
     uint32_t hour : 5;
     uint32_t minute : 6;
     uint32_t mode : 1;
+    uint8_t watch_face_index;
 } wake_face_state_t;
 
 void wake_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void **context_ptr);
 void wake_face_activate(movement_settings_t *settings, void *context);
 bool wake_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
 void wake_face_resign(movement_settings_t *settings, void *context);
-bool wake_face_wants_background_task(movement_settings_t *settings, void *context);
 
 #define wake_face ((const watch_face_t){ \
     wake_face_setup, \
     wake_face_activate, \
     wake_face_loop, \
     wake_face_resign, \
-    wake_face_wants_background_task \
+    NULL, \
+    MOVEMENT_CONTEXT(wake_face_state_t), \
 })
 
 #endif // WAKE_FACE_H_
@@ -25,36 +25,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include "chirpy_demo_face.h"
-#include "chirpy_tx.h"
 #include "filesystem.h"
 
-typedef enum {
-    CDM_CHOOSE = 0,
-    CDM_CHIRPING,
-} chirpy_demo_mode_t;
-
-typedef enum {
-    CDP_SCALE = 0,
-    CDP_INFO_SHORT,
-    CDP_INFO_LONG,
-    CDP_INFO_NANOSEC,
-} chirpy_demo_program_t;
-
-typedef struct {
-    // Current mode
-    chirpy_demo_mode_t mode;
-
-    // Selected program
-    chirpy_demo_program_t program;
-
-    // Helps us handle 1/64 ticks during transmission; including countdown timer
-    chirpy_tick_state_t tick_state;
-
-    // Used by chirpy encoder during transmission
-    chirpy_encoder_state_t encoder_state;
-
-} chirpy_demo_state_t;
-
 static uint8_t long_data_str[] =
     "There once was a ship that put to sea\n"
     "The name of the ship was the Billy of Tea\n"
@@ -98,9 +70,8 @@ static uint16_t nanosec_buffer_size = 0;
 
 void chirpy_demo_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void **context_ptr) {
     (void)settings;
-    (void)watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(chirpy_demo_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(chirpy_demo_state_t));
         memset(*context_ptr, 0, sizeof(chirpy_demo_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
     }
@@ -51,6 +51,34 @@
  */
 
 #include "movement.h"
+#include "chirpy_tx.h"
+
+typedef enum {
+    CDM_CHOOSE = 0,
+    CDM_CHIRPING,
+} chirpy_demo_mode_t;
+
+typedef enum {
+    CDP_SCALE = 0,
+    CDP_INFO_SHORT,
+    CDP_INFO_LONG,
+    CDP_INFO_NANOSEC,
+} chirpy_demo_program_t;
+
+typedef struct {
+    // Current mode
+    chirpy_demo_mode_t mode;
+
+    // Selected program
+    chirpy_demo_program_t program;
+
+    // Helps us handle 1/64 ticks during transmission; including countdown timer
+    chirpy_tick_state_t tick_state;
+
+    // Used by chirpy encoder during transmission
+    chirpy_encoder_state_t encoder_state;
+
+} chirpy_demo_state_t;
 
 void chirpy_demo_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
 void chirpy_demo_face_activate(movement_settings_t *settings, void *context);
@@ -63,6 +91,7 @@ void chirpy_demo_face_resign(movement_settings_t *settings, void *context);
     chirpy_demo_face_loop, \
     chirpy_demo_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(chirpy_demo_state_t), \
 })
 
 #endif // CHIRPY_DEMO_FACE_H_
@@ -28,7 +28,7 @@
 
 // NOTE: since this face deals directly with the SAM L22's SUPC and RTC registers,
 // it won't build for the simulator or really do anything. so let's not.
-#ifndef __EMSCRIPTEN__
+#if !defined(__EMSCRIPTEN__) && !defined(WATCH_HOST)
 
 // Waveform output. Comes out on pin A1 of the 9-pin connector. Output is enabled
 // when the watch face is activated and disabled when deactivated.
@@ -71,9 +71,8 @@ static void _disable_output() {
 
 void frequency_correction_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(frequency_correction_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(frequency_correction_state_t));
         frequency_correction_state_t *state = (frequency_correction_state_t *)*context_ptr;
         state->period_event_output = 0;
     }
@@ -54,6 +54,7 @@ void frequency_correction_face_resign(movement_settings_t *settings, void *conte
     frequency_correction_face_loop, \
     frequency_correction_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(frequency_correction_state_t), \
 })
 
 #endif // FREQUENCY_CORRECTION_FACE_H_
@@ -31,11 +31,10 @@ void hello_there_face_setup(movement_settings_t *settings, uint8_t watch_face_in
     // These next two lines just silence the compiler warnings associated with unused parameters.
     // We have no use for the settings or the watch_face_index, so we make that explicit here.
     (void) settings;
-    (void) watch_face_index;
     // At boot, context_ptr will be NULL indicating that we don't have anyplace to store our context.
     if (*context_ptr == NULL) {
         // in this case, we allocate an area of memory sufficient to store the stuff we need to track.
-        *context_ptr = malloc(sizeof(hello_there_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(hello_there_state_t));
     }
 }
 
@@ -50,6 +50,7 @@ void hello_there_face_resign(movement_settings_t *settings, void *context);
     hello_there_face_loop, \
     hello_there_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(hello_there_state_t), \
 })
 
 #endif // HELLO_THERE_FACE_H_
@@ -113,9 +113,8 @@ static void _lis2dw_logging_face_log_data(lis2dw_logger_state_t *logger_state) {
 
 void lis2dw_logging_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(lis2dw_logger_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(lis2dw_logger_state_t));
         memset(*context_ptr, 0, sizeof(lis2dw_logger_state_t));
         watch_enable_i2c();
         lis2dw_begin();
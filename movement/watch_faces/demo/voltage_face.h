@@ -49,6 +49,7 @@ void voltage_face_resign(movement_settings_t *settings, void *context);
     voltage_face_loop, \
     voltage_face_resign, \
     NULL, \
+    MOVEMENT_NO_CONTEXT, \
 })
 
 #endif // VOLTAGE_FACE_H_
@@ -28,12 +28,24 @@
 #include "watch_utility.h"
 #include "lis2dw.h"
 #include "spiflash.h"
+#include "spiflash_log.h"
 
 #define ACCELEROMETER_RANGE LIS2DW_RANGE_4_G
 #define ACCELEROMETER_LPMODE LIS2DW_LP_MODE_2
 #define ACCELEROMETER_FILTER LIS2DW_BANDWIDTH_FILTER_DIV2
 #define ACCELEROMETER_LOW_NOISE true
 #define SECONDS_TO_RECORD 15
+#define SAMPLES_PER_SECOND 25
+#define CENTISECONDS_PER_SAMPLE (100 / SAMPLES_PER_SECOND)
+// drain the FIFO once a second's worth of samples is in it. the FIFO holds 32, so this leaves room for a
+// few more to come in before we get to it.
+#define FIFO_THRESHOLD SAMPLES_PER_SECOND
+// the SPI flash takes A1 through A4, so the accelerometer's INT1 is wired to A0.
+#define ACCELEROMETER_INT1_PIN A0
+// the records go in a log that takes up the first half of the 2 MB flash chip; the second half is the external
+// filesystem's (see filesystem_mount_external).
+#define LOG_FIRST_PAGE 0
+#define LOG_NUM_PAGES 4096
 
 static const char activity_types[][3] = {
     "TE",   // Testing
@@ -57,45 +69,35 @@ static void update(accelerometer_data_acquisition_state_t *state);
 static void update_settings(accelerometer_data_acquisition_state_t *state);
 static void advance_current_setting(accelerometer_data_acquisition_state_t *state);
 static void start_reading(accelerometer_data_acquisition_state_t *state, movement_settings_t *settings);
-static void continue_reading(accelerometer_data_acquisition_state_t *state);
+static void log_header(accelerometer_data_acquisition_state_t *state, movement_settings_t *settings);
+static void continue_reading(accelerometer_data_acquisition_state_t *state, movement_settings_t *settings);
+static void drain_fifo(accelerometer_data_acquisition_state_t *state, movement_settings_t *settings);
 static void finish_reading(accelerometer_data_acquisition_state_t *state);
-static bool wait_for_flash_ready(void);
-static int16_t get_next_available_page(void);
-static void write_buffer_to_page(uint8_t *buf, uint16_t page);
-static void write_page(accelerometer_data_acquisition_state_t *state);
-static void log_data_point(accelerometer_data_acquisition_state_t *state, lis2dw_reading_t reading, uint8_t centiseconds);
+static void update_next_available_page(accelerometer_data_acquisition_state_t *state);
+static void log_data_point(accelerometer_data_acquisition_state_t *state, lis2dw_reading_t reading);
 
 void accelerometer_data_acquisition_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
     accelerometer_data_acquisition_state_t *state = (accelerometer_data_acquisition_state_t *)*context_ptr;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(accelerometer_data_acquisition_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(accelerometer_data_acquisition_state_t));
         memset(*context_ptr, 0, sizeof(accelerometer_data_acquisition_state_t));
         state = (accelerometer_data_acquisition_state_t *)*context_ptr;
         state->beep_with_countdown = true;
         state->countdown_length = 3;
     }
     spi_flash_init();
-    wait_for_flash_ready();
-    uint8_t buf[256] = {0xFF};
-    spi_flash_read_data(0, buf, 256);
-    if (buf[0] & 0xF0) {
-        // mark first four pages as used
-        buf[0] = 0x0F;
-        wait_for_flash_ready();
-        watch_set_pin_level(A3, false);
-        spi_flash_command(CMD_ENABLE_WRITE);
-        wait_for_flash_ready();
-        spi_flash_write_data(0, buf, 256);
-    }
-
 }
 
 void accelerometer_data_acquisition_face_activate(movement_settings_t *settings, void *context) {
     (void) settings;
     accelerometer_data_acquisition_state_t *state = (accelerometer_data_acquisition_state_t *)context;
-    state->next_available_page = get_next_available_page();
+    // finds the end of the log: a binary search over the page headers, reading a dozen or so of them.
+    if (spi_flash_log_mount(&state->log, LOG_FIRST_PAGE, LOG_NUM_PAGES, sizeof(accelerometer_data_acquisition_record_t))) {
+        update_next_available_page(state);
+    } else {
+        state->next_available_page = -1;
+    }
 }
 
 bool accelerometer_data_acquisition_face_loop(movement_event_t event, movement_settings_t *settings, void *context) {
@@ -128,7 +130,7 @@ bool accelerometer_data_acquisition_face_loop(movement_event_t event, movement_s
                         if (state->countdown_ticks == 0) {
                             // at zero, begin reading
                             state->mode = ACCELEROMETER_DATA_ACQUISITION_MODE_SENSING;
-                            state->reading_ticks = SECONDS_TO_RECORD + 1;
+                            state->reading_ticks = SECONDS_TO_RECORD;
                             // also beep if the user asked for it
                             if (state->beep_with_countdown) watch_buzzer_play_note(BUZZER_NOTE_C6, 75);
                             start_reading(state, settings);
@@ -140,18 +142,9 @@ bool accelerometer_data_acquisition_face_loop(movement_event_t event, movement_s
                     update(state);
                     break;
                 case ACCELEROMETER_DATA_ACQUISITION_MODE_SENSING:
-                    if (state->reading_ticks > 0) {
-                        state->reading_ticks--;
-                        if (state->reading_ticks > 0) {
-                            continue_reading(state);
-                        } else {
-                            finish_reading(state);
-                            state->mode = ACCELEROMETER_DATA_ACQUISITION_MODE_IDLE;
-                            watch_buzzer_play_note(BUZZER_NOTE_C4, 125);
-                            watch_buzzer_play_note(BUZZER_NOTE_REST, 50);
-                            watch_buzzer_play_note(BUZZER_NOTE_C4, 125);
-                        }
-                    }
+                    // samples come in with EVENT_ACCELEROMETER_FIFO, on the rising edge of INT1. INT1 stays high until
+                    // we drain the FIFO, though, so if we ever miss that edge, no other one is coming. check here.
+                    if (watch_get_pin_level(ACCELEROMETER_INT1_PIN)) drain_fifo(state, settings);
                     update(state);
                     break;
                 case ACCELEROMETER_DATA_ACQUISITION_MODE_SETTINGS:
@@ -159,6 +152,12 @@ bool accelerometer_data_acquisition_face_loop(movement_event_t event, movement_s
                     break;
             }
             break;
+        case EVENT_ACCELEROMETER_FIFO:
+            if (state->mode == ACCELEROMETER_DATA_ACQUISITION_MODE_SENSING) {
+                drain_fifo(state, settings);
+                update(state);
+            }
+            break;
         case EVENT_LIGHT_BUTTON_UP:
             switch (state->mode) {
                 case ACCELEROMETER_DATA_ACQUISITION_MODE_IDLE:
@@ -256,17 +255,20 @@ static void update(accelerometer_data_acquisition_state_t *state) {
             ticks = 0;
             break;
     }
+    // percent of the log that's free, which only has room for two digits.
+    uint16_t free_pages = state->next_available_page < 0 ? 0 : spi_flash_log_get_free_pages(&state->log);
+    uint8_t percent_free = free_pages * 100 / LOG_NUM_PAGES;
     sprintf(buf, "%s%2dre%2d#o",
             activity_types[state->activity_type_index],
             ticks,
-            (8192 - state->next_available_page) / 82);
+            percent_free > 99 ? 99 : percent_free);
     watch_display_string(buf, 0);
 
     watch_set_colon();
 
     // special case: display full if full, <1% if nearly full
     if (state->next_available_page < 0) watch_display_string(" FUL", 6);
-    else if (state->next_available_page > 8110) watch_display_string("<1", 6);
+    else if (percent_free == 0) watch_display_string("<1", 6);
 
     // Bell if beep enabled
     if (state->beep_with_countdown) watch_set_indicator(WATCH_INDICATOR_BELL);
@@ -329,91 +331,12 @@ static void advance_current_setting(accelerometer_data_acquisition_state_t *stat
     }
 }
 
-static int16_t get_next_available_page(void) {
-    uint8_t buf[256] = {0};
-
-    uint16_t page = 0;
-    for(int16_t i = 0; i < 4; i++) {
-        wait_for_flash_ready();
-        spi_flash_read_data(i * 256, buf, 256);
-        for(int16_t j = 0; j < 256; j++) {
-            if(buf[j] == 0) {
-                page += 8;
-            } else {
-                page += __builtin_clz(((uint32_t)buf[j]) << 24);
-                break;
-            }
-        }
-    }
-
-    if (page >= 8192) return -1;
-
-    return page;
-}
-
-static void write_buffer_to_page(uint8_t *buf, uint16_t page) {
-    uint32_t address = 256 * page;
-
-    wait_for_flash_ready();
-    watch_set_pin_level(A3, false);
-    spi_flash_command(CMD_ENABLE_WRITE);
-    wait_for_flash_ready();
-    watch_set_pin_level(A3, false);
-    spi_flash_write_data(address, buf, 256);
-    wait_for_flash_ready();
-
-    uint8_t buf2[256];
-    watch_set_pin_level(A3, false);
-    spi_flash_read_data(address, buf2, 256);
-    wait_for_flash_ready();
-
-    uint8_t used_pages[256] = {0xFF};
-    uint16_t address_to_mark_used = page / 8;
-    uint8_t header_page = address_to_mark_used / 256;
-    uint8_t used_byte = 0x7F >> (page % 8);
-    uint8_t offset_in_buf = address_to_mark_used % 256;
-
-    printf("\twrite 256 bytes to address %ld, page %d.\n", address, page);
-    for(int i = 0; i < 256; i++) {
-        if (buf[i] != buf2[i]) {
-            printf("\tData mismatch detected at offset  %d: %d != %d.\n", i, buf[i], buf2[i]);
-        }
-    }
-
-    watch_set_pin_level(A3, false);
-    spi_flash_read_data(header_page * 256, used_pages, 256);
-    used_pages[offset_in_buf] = used_byte;
-    watch_set_pin_level(A3, false);
-    spi_flash_command(CMD_ENABLE_WRITE);
-    wait_for_flash_ready();
-    watch_set_pin_level(A3, false);
-    spi_flash_write_data(header_page * 256, used_pages, 256);
-    wait_for_flash_ready();
-}
-
-static bool wait_for_flash_ready(void) {
-    watch_set_pin_level(A3, false);
-    bool ok = true;
-    uint8_t read_status_response[1] = {0x00};
-    do {
-        ok = spi_flash_read_command(CMD_READ_STATUS, read_status_response, 1);
-    } while ((read_status_response[0] & 0x3) != 0);
-    delay_ms(1); // why do i need this?
-    watch_set_pin_level(A3, true);
-    return ok;
+static void update_next_available_page(accelerometer_data_acquisition_state_t *state) {
+    if (spi_flash_log_get_free_pages(&state->log)) state->next_available_page = state->log.next_page;
+    else state->next_available_page = -1;
 }
 
-static void write_page(accelerometer_data_acquisition_state_t *state) {
-    if (state->next_available_page > 0) {
-        write_buffer_to_page((uint8_t *)(state->records), state->next_available_page);
-        wait_for_flash_ready();
-        state->next_available_page++;
-    }
-    state->pos = 0;
-    memset(state->records, 0xFF, sizeof(state->records));
-}
-
-static void log_data_point(accelerometer_data_acquisition_state_t *state, lis2dw_reading_t reading, uint8_t centiseconds) {
+static void log_data_point(accelerometer_data_acquisition_state_t *state, lis2dw_reading_t reading) {
     accelerometer_data_acquisition_record_t record;
     record.data.x.record_type = ACCELEROMETER_DATA_ACQUISITION_DATA;
     record.data.y.lpmode = ACCELEROMETER_LPMODE;
@@ -421,12 +344,11 @@ static void log_data_point(accelerometer_data_acquisition_state_t *state, lis2dw
     record.data.x.accel = (reading.x >> 2) + 8192;
     record.data.y.accel = (reading.y >> 2) + 8192;
     record.data.z.accel = (reading.z >> 2) + 8192;
-    record.data.counter = 100 * (SECONDS_TO_RECORD - state->reading_ticks + 1) + centiseconds;
+    record.data.counter = (state->samples_logged - state->header_sample) * CENTISECONDS_PER_SAMPLE;
     printf("logged data point for %d\n", record.data.counter);
-    state->records[state->pos++] = record;
-    if (state->pos >= 32) {
-        write_page(state);
-    }
+    // fills up the log's page buffer, and programs a page when it's full.
+    spi_flash_log_append(&state->log, &record);
+    update_next_available_page(state);
 }
 
 static void start_reading(accelerometer_data_acquisition_state_t *state, movement_settings_t *settings) {
@@ -438,8 +360,18 @@ static void start_reading(accelerometer_data_acquisition_state_t *state, movemen
     lis2dw_set_low_power_mode(ACCELEROMETER_LPMODE);
     lis2dw_set_bandwidth_filtering(ACCELEROMETER_FILTER);
     if (ACCELEROMETER_LOW_NOISE) lis2dw_set_low_noise_mode(true);
-    lis2dw_enable_fifo();
+    lis2dw_configure_fifo_threshold_int1(FIFO_THRESHOLD);
+    movement_enable_accelerometer_fifo_interrupt(ACCELEROMETER_INT1_PIN);
 
+    state->samples_logged = 0;
+    state->fifo_overruns = 0;
+    log_header(state, settings);
+    lis2dw_fifo_t fifo;
+    lis2dw_read_fifo(&fifo); // dump the fifo, so that the first sample we log comes in after the header's timestamp
+}
+
+// writes a header stamped with the time now; the data points after it count their time from it.
+static void log_header(accelerometer_data_acquisition_state_t *state, movement_settings_t *settings) {
     accelerometer_data_acquisition_record_t record;
     watch_date_time date_time = watch_rtc_get_date_time();
     state->starting_timestamp = watch_utility_date_time_to_unix_time(date_time, movement_timezone_offsets[settings->bit.time_zone] * 60);
@@ -450,31 +382,51 @@ static void start_reading(accelerometer_data_acquisition_state_t *state, movemen
     record.header.char2 = activity_types[state->activity_type_index][1];
     record.header.timestamp = state->starting_timestamp;
 
-    state->records[state->pos++] = record;
-    lis2dw_fifo_t fifo;
-    lis2dw_read_fifo(&fifo); // dump the fifo, this starts a fresh round of data in continue_reading
+    spi_flash_log_append(&state->log, &record);
+    state->header_sample = state->samples_logged;
 }
 
-static void continue_reading(accelerometer_data_acquisition_state_t *state) {
+static void continue_reading(accelerometer_data_acquisition_state_t *state, movement_settings_t *settings) {
     printf("Continue reading\n");
     lis2dw_fifo_t fifo;
-    lis2dw_read_fifo(&fifo);
+    // this drains the FIFO below the threshold, which lets INT1 go low so that the next batch raises it again.
+    if (lis2dw_read_fifo(&fifo)) {
+        // the FIFO filled up before we got to it, and the accelerometer wrote over samples we never saw, so counting
+        // samples no longer gives their time. like start_reading, start over from a fresh header and drop this
+        // batch, since we can't tell when its samples were taken.
+        state->fifo_overruns++;
+        printf("FIFO overrun %d, dropped %d samples\n", state->fifo_overruns, fifo.count);
+        log_header(state, settings);
+        fifo.count = 0;
+    }
 
-    fifo.count = min(fifo.count, 25); // hacky, but we need a consistent data rate; if we got a 26th data point, chuck it.
-    uint8_t offset = 4 * (25 - fifo.count); // also hacky: we're sometimes short at the start. align to beginning of next second.
-    // TODO: use the threshold interrupt for this, will mean we get consistent 25 Hz data as the accelerometer sees it.
+    // every sample is one 25 Hz tick of the accelerometer's clock after the last, so counting them gives their
+    // timestamps; we log them all, right up until we have SECONDS_TO_RECORD seconds' worth.
+    for(int i = 0; i < fifo.count && state->samples_logged < SECONDS_TO_RECORD * SAMPLES_PER_SECOND; i++) {
+        log_data_point(state, fifo.readings[i]);
+        state->samples_logged++;
+    }
+    state->reading_ticks = SECONDS_TO_RECORD - state->samples_logged / SAMPLES_PER_SECOND;
+}
 
-    for(int i = 0; i < fifo.count; i++) {
-        log_data_point(state, fifo.readings[i], i * 4 + offset);
+static void drain_fifo(accelerometer_data_acquisition_state_t *state, movement_settings_t *settings) {
+    continue_reading(state, settings);
+    if (state->reading_ticks == 0) {
+        finish_reading(state);
+        state->mode = ACCELEROMETER_DATA_ACQUISITION_MODE_IDLE;
+        watch_buzzer_play_note(BUZZER_NOTE_C4, 125);
+        watch_buzzer_play_note(BUZZER_NOTE_REST, 50);
+        watch_buzzer_play_note(BUZZER_NOTE_C4, 125);
     }
 }
 
 static void finish_reading(accelerometer_data_acquisition_state_t *state) {
-    printf("Finish reading\n");
-    if (state->pos != 0) {
-        write_page(state);
-    }
+    printf("Finish reading, %d FIFO overrun(s)\n", state->fifo_overruns);
+    spi_flash_log_flush(&state->log);
+    update_next_available_page(state);
+    movement_disable_accelerometer_fifo_interrupt(ACCELEROMETER_INT1_PIN);
     lis2dw_set_data_rate(LIS2DW_DATA_RATE_POWERDOWN);
+    lis2dw_disable_fifo();
     watch_disable_i2c();
 
     state->repeat_ticks = state->repeat_interval;
@@ -32,6 +32,7 @@
  */
 
 #include "movement.h"
+#include "spiflash_log.h"
 
 #define ACCELEROMETER_DATA_ACQUISITION_INVALID ((uint64_t)(0b11))   // all bits are 1 when the flash is erased
 #define ACCELEROMETER_DATA_ACQUISITION_HEADER ((uint64_t)(0b10))
@@ -96,9 +97,11 @@ typedef struct {
     uint8_t countdown_ticks;
     uint8_t repeat_ticks;
     uint8_t reading_ticks;
+    uint16_t samples_logged;
+    uint16_t header_sample;         // samples_logged as of the last header, which the data points count from
+    uint8_t fifo_overruns;          // times the FIFO overflowed this recording; each one starts a new header
     uint32_t starting_timestamp;
-    accelerometer_data_acquisition_record_t records[32];
-    uint16_t pos;
+    spi_flash_log_t log;
 } accelerometer_data_acquisition_state_t;
 
 void accelerometer_data_acquisition_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr);
@@ -112,6 +115,7 @@ void accelerometer_data_acquisition_face_resign(movement_settings_t *settings, v
     accelerometer_data_acquisition_face_loop, \
     accelerometer_data_acquisition_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(accelerometer_data_acquisition_state_t), \
 })
 
 #endif // ACCELEROMETER_DATA_ACQUISITION_FACE_H_
@@ -186,6 +186,7 @@ static const uint8_t lightmeter_addr = 0x44;
     lightmeter_face_loop, \
     lightmeter_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(lightmeter_state_t), \
 })
 
 #endif // LIGHTMETER_FACE_H_
@@ -74,10 +74,11 @@ static void _thermistor_logging_face_update_display(thermistor_logger_state_t *l
 
 void thermistor_logging_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(thermistor_logger_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(thermistor_logger_state_t));
         memset(*context_ptr, 0, sizeof(thermistor_logger_state_t));
+        // log a data point at the top of each hour.
+        movement_subscribe_background_task_for_face(watch_face_index, (movement_subscription_t){ .type = MOVEMENT_SUBSCRIBE_TOP_OF_HOUR });
     }
 }
 
@@ -129,11 +130,3 @@ void thermistor_logging_face_resign(movement_settings_t *settings, void *context
     (void) settings;
     (void) context;
 }
-
-bool thermistor_logging_face_wants_background_task(movement_settings_t *settings, void *context) {
-    (void) settings;
-    (void) context;
-    // this will get called at the top of each minute, so all we check is if we're at the top of the hour as well.
-    // if we are, we ask for a background task.
-    return watch_rtc_get_date_time().unit.minute == 0;
-}
@@ -74,14 +74,14 @@ void thermistor_logging_face_setup(movement_settings_t *settings, uint8_t watch_
 void thermistor_logging_face_activate(movement_settings_t *settings, void *context);
 bool thermistor_logging_face_loop(movement_event_t event, movement_settings_t *settings, void *context);
 void thermistor_logging_face_resign(movement_settings_t *settings, void *context);
-bool thermistor_logging_face_wants_background_task(movement_settings_t *settings, void *context);
 
 #define thermistor_logging_face ((const watch_face_t){ \
     thermistor_logging_face_setup, \
     thermistor_logging_face_activate, \
     thermistor_logging_face_loop, \
     thermistor_logging_face_resign, \
-    thermistor_logging_face_wants_background_task, \
+    NULL, \
+    MOVEMENT_CONTEXT(thermistor_logger_state_t), \
 })
 
 #endif // THERMISTOR_LOGGING_FACE_H_
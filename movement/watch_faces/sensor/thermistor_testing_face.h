@@ -49,6 +49,7 @@ void thermistor_testing_face_resign(movement_settings_t *settings, void *context
     thermistor_testing_face_loop, \
     thermistor_testing_face_resign, \
     NULL, \
+    MOVEMENT_NO_CONTEXT, \
 })
 
 #endif // THERMISTOR_TESTING_FACE_H_
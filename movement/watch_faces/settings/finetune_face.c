@@ -104,7 +104,7 @@ static void finetune_adjust_subseconds(int delta) {
 
     // Then delay clock
     watch_rtc_enable(false);
-    delay_ms(delta);
+    watch_delay_ms(delta);
     if (delta > 500) {
         watch_date_time date_time = watch_rtc_get_date_time();
         date_time.unit.second = (date_time.unit.second + 1) % 60;
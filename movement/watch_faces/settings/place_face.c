@@ -60,7 +60,7 @@ static void _data_save_place_to_memory(place_state_t *state);
 static void _data_save_place_to_register(place_state_t *state);
 static void _data_save_place_to_file(place_state_t *state);
 static bool _quick_ticks_running;
-static void _abort_quick_ticks();
+static void _abort_quick_ticks(void);
 
 // PUBLIC FUNCTIONS ///////////////////////////////////////////////////////////
 
@@ -110,7 +110,7 @@ void place_latlon_to_geohash(char *hash, double latitude, double longitude) {
 void place_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(place_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(place_state_t));
         memset(*context_ptr, 0, sizeof(place_state_t));
         // Do any one-time tasks in here; the inside of this conditional happens only at boot.
     }
@@ -1332,7 +1332,7 @@ static void _data_save_place_to_register(place_state_t *state) {
     movement_location.bit.latitude = lat;
     movement_location.bit.longitude = lon;
     watch_store_backup_data(movement_location.reg, 1);
-    delay_ms(100);
+    watch_delay_ms(100);
     watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
 }
 
@@ -1365,18 +1365,18 @@ static void _data_save_place_to_file(place_state_t *state) {
     place.latitude = _convert_decimal_struct_to_int(state->working_latitude);
     place.longitude = _convert_decimal_struct_to_int(state->working_longitude);
     if (filesystem_write_file("place.loc", (char*)&place, sizeof(place))) {
-        delay_ms(100);
+        watch_delay_ms(100);
         watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
     } else {
         watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
-        delay_ms(100);
+        watch_delay_ms(100);
         watch_set_indicator(WATCH_INDICATOR_BELL);        
     }
 }
 
 /** @brief abort quick ticks
  */
-static void _abort_quick_ticks() {
+static void _abort_quick_ticks(void) {
     if (_quick_ticks_running) {
         _quick_ticks_running = false;
         movement_request_tick_frequency(4);
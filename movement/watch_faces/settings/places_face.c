@@ -43,14 +43,14 @@ static void _data_load_place_from_file(places_state_t *state);
 static void _data_save_place_to_register(places_state_t *state);
 static void _data_save_place_to_file(places_state_t *state);
 static bool _quick_ticks_running;
-static void _abort_quick_ticks();
+static void _abort_quick_ticks(void);
 
 // MOVEMENT WATCH FACE FUNCTIONS //////////////////////////////////////////////
 
 void places_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(places_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(places_state_t));
         memset(*context_ptr, 0, sizeof(places_state_t));
         places_state_t *state = (places_state_t *)*context_ptr;
     
@@ -299,7 +299,7 @@ static void _data_save_place_to_register(places_state_t *state) {
     movement_location.bit.latitude = lat;
     movement_location.bit.longitude = lon;
     watch_store_backup_data(movement_location.reg, 1);
-    delay_ms(100);
+    watch_delay_ms(100);
     watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
 }
 
@@ -331,11 +331,11 @@ static void _data_save_place_to_file(places_state_t *state) {
     coordinate_t place;
     place = state->places[0].location;
     if (filesystem_write_file("place.loc", (char*)&place, sizeof(place))) {
-        delay_ms(200);
+        watch_delay_ms(200);
         watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
     } else {
         watch_set_indicator(WATCH_INDICATOR_BELL);
-        delay_ms(1000);
+        watch_delay_ms(1000);
         watch_clear_indicator(WATCH_INDICATOR_BELL);
         watch_clear_indicator(WATCH_INDICATOR_SIGNAL);
         
@@ -344,7 +344,7 @@ static void _data_save_place_to_file(places_state_t *state) {
 
 /** @brief abort quick ticks
  */
-static void _abort_quick_ticks() {
+static void _abort_quick_ticks(void) {
     if (_quick_ticks_running) {
         _quick_ticks_running = false;
         movement_request_tick_frequency(4);
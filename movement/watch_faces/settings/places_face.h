@@ -90,6 +90,7 @@ void places_face_resign(movement_settings_t *settings, void *context);
     places_face_loop, \
     places_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(places_state_t), \
 })
 
 #endif // PLACES_FACE_H_
@@ -89,6 +89,7 @@ void preferences_face_resign(movement_settings_t *settings, void *context);
     preferences_face_loop, \
     preferences_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(uint8_t), \
 })
 
 #endif // PREFERENCES_FACE_H_
@@ -75,9 +75,8 @@ static void load_saves_to_state(save_load_state_t *state) {
 
 void save_load_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
     if (*context_ptr == NULL) {
-        *context_ptr = malloc(sizeof(save_load_state_t));
+        *context_ptr = movement_claim_context(watch_face_index, sizeof(save_load_state_t));
         memset(*context_ptr, 0, sizeof(save_load_state_t));
     }
 }
@@ -76,6 +76,7 @@ void save_load_face_resign(movement_settings_t *settings, void *context);
     save_load_face_loop, \
     save_load_face_resign, \
     NULL, \
+    MOVEMENT_CONTEXT(save_load_state_t), \
 })
 
 #endif // SAVE_LOAD_FACE_H_
@@ -34,8 +34,7 @@ watch_date_time date_time_settings;
 
 void set_time_hackwatch_face_setup(movement_settings_t *settings, uint8_t watch_face_index, void ** context_ptr) {
     (void) settings;
-    (void) watch_face_index;
-    if (*context_ptr == NULL) *context_ptr = malloc(sizeof(uint8_t));
+    if (*context_ptr == NULL) *context_ptr = movement_claim_context(watch_face_index, sizeof(uint8_t));
 }
 
 void set_time_hackwatch_face_activate(movement_settings_t *settings, void *context) {
@@ -8,18 +8,24 @@ SUBMODULES = tinyusb
 
 COBRA = cobra -f
 
-ifndef EMSCRIPTEN
+ifdef HOST
+all: $(BUILD)/$(BIN)
+else ifndef EMSCRIPTEN
 all: $(BUILD)/$(BIN).elf $(BUILD)/$(BIN).hex $(BUILD)/$(BIN).bin $(BUILD)/$(BIN).uf2 size
 else
 all: $(BUILD)/$(BIN).html
 endif
 
+$(BUILD)/$(BIN): $(OBJS)
+	@echo LD $@
+	@$(CC) $(LDFLAGS) $(OBJS) $(LIBS) -o $@
+
 $(BUILD)/$(BIN).html: $(OBJS)
 	@echo HTML $@
 	@$(CC) $(LDFLAGS) $(OBJS) $(LIBS) -o $@ \
 		-s ASYNCIFY=1 \
 		-s EXPORTED_RUNTIME_METHODS=lengthBytesUTF8,printErr \
-		-s EXPORTED_FUNCTIONS=_main \
+		-s EXPORTED_FUNCTIONS=_main,_resume_main_loop \
 		--shell-file=$(TOP)/watch-library/simulator/shell.html
 
 $(BUILD)/$(BIN).elf: $(OBJS)
@@ -49,6 +55,12 @@ $(BUILD)/%.o: | $(SUBMODULES) directory
 	@echo CC $@
 	@$(CC) $(CFLAGS) $(filter %/$(subst .o,.c,$(notdir $@)), $(SRCS)) -c -o $@
 
+$(BUILD)/watch_private_display.o: $(DISPLAY_TABLES)
+
+$(DISPLAY_TABLES): $(TOP)/watch-library/shared/watch/watch_private_display.h $(TOP)/utils/segment_tables.py | directory
+	@echo GEN $@
+	@python3 $(TOP)/utils/segment_tables.py $< $@
+
 directory:
 	@$(MKDIR) -p $(BUILD)
 
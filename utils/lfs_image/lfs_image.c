@@ -0,0 +1,142 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 The Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+// Builds a LittleFS image of a directory for the watch's RWW EEPROM. This is Movement's own filesystem.c on top
+// of the host backend's emulated EEPROM, so the image has exactly the geometry and settings the watch mounts
+// with. See lfs_image.py, which turns the image into a UF2 and can merge it with a firmware UF2.
+//
+//   lfs_image DIRECTORY IMAGE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include "filesystem.h"
+#include "watch_host.h"
+
+static int num_files = 0;
+static int num_dirs = 0;
+
+static bool read_host_file(const char *path, char **data, long *size) {
+    FILE *f = fopen(path, "rb");
+    if (!f) return false;
+    fseek(f, 0, SEEK_END);
+    *size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    *data = malloc(*size ? *size : 1);
+    bool ok = fread(*data, 1, *size, f) == (size_t)*size;
+    fclose(f);
+    return ok;
+}
+
+// copies everything in host_dir into watch_dir, which must already exist. entries are sorted, so the same
+// directory always makes the same image.
+static bool copy_dir(const char *host_dir, const char *watch_dir) {
+    struct dirent **entries;
+    int n = scandir(host_dir, &entries, NULL, alphasort);
+    if (n < 0) {
+        perror(host_dir);
+        return false;
+    }
+
+    bool ok = true;
+    for (int i = 0; i < n; i++) {
+        const char *name = entries[i]->d_name;
+        char host_path[1024];
+        char watch_path[LFS_NAME_MAX + 1];
+        struct stat st;
+
+        if (!ok || name[0] == '.') goto next;
+        snprintf(host_path, sizeof(host_path), "%s/%s", host_dir, name);
+        if ((size_t)snprintf(watch_path, sizeof(watch_path), "%s%s", watch_dir, name) >= sizeof(watch_path)) {
+            fprintf(stderr, "%s: path too long\n", host_path);
+            ok = false;
+            goto next;
+        }
+        if (stat(host_path, &st)) {
+            perror(host_path);
+            ok = false;
+            goto next;
+        }
+
+        if (S_ISDIR(st.st_mode)) {
+            if (!filesystem_mkdir(watch_path)) {
+                fprintf(stderr, "%s: can't create directory\n", watch_path);
+                ok = false;
+                goto next;
+            }
+            num_dirs++;
+            strcat(watch_path, "/");
+            ok = copy_dir(host_path, watch_path);
+        } else if (S_ISREG(st.st_mode)) {
+            char *data;
+            long size;
+            if (!read_host_file(host_path, &data, &size)) {
+                perror(host_path);
+                ok = false;
+                goto next;
+            }
+            if (!filesystem_write_file(watch_path, data, size) || filesystem_get_file_size(watch_path) != size) {
+                fprintf(stderr, "%s: can't write %ld bytes (%ld bytes free)\n", watch_path, size, (long)filesystem_get_free_space());
+                ok = false;
+            }
+            free(data);
+            num_files++;
+        }
+next:
+        free(entries[i]);
+    }
+    free(entries);
+
+    return ok;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s DIRECTORY IMAGE\n", argv[0]);
+        return 2;
+    }
+
+    // start from an erased EEPROM, so that the blocks littlefs doesn't use are left erased on the watch too.
+    uint32_t size;
+    uint8_t *storage = watch_host_get_storage(&size);
+    memset(storage, 0xff, size);
+    if (!filesystem_init()) {
+        fprintf(stderr, "can't format the filesystem\n");
+        return 1;
+    }
+
+    if (!copy_dir(argv[1], "")) return 1;
+
+    FILE *f = fopen(argv[2], "wb");
+    if (!f || fwrite(storage, 1, size, f) != size || fclose(f)) {
+        perror(argv[2]);
+        return 1;
+    }
+
+    printf("%d files in %d directories, %ld bytes used, %ld bytes free\n", num_files, num_dirs,
+           (long)filesystem_get_used_space(), (long)filesystem_get_free_space());
+    return 0;
+}
@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+# MIT License
+#
+# Copyright (c) 2026 The Sensor Watch contributors
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+
+# Builds a LittleFS image of a directory for the watch's 8 kilobyte RWW EEPROM, for putting TOTP URIs, places and
+# so on onto watches in bulk instead of typing them into the serial shell a line at a time. The image is laid out
+# by Movement's own filesystem.c (see lfs_image.c), so it has the same geometry and settings the watch mounts it
+# with, and subdirectories work.
+#
+#   python3 lfs_image.py DIRECTORY -o filesystem.uf2                        # just the filesystem
+#   python3 lfs_image.py DIRECTORY -f ../../movement/make/build/watch.uf2   # firmware and filesystem together
+#   python3 lfs_image.py DIRECTORY --bin -o filesystem.bin                  # the raw image
+#
+# Then flash the UF2 as usual, i.e. with `python3 ../uf2conv.py -D filesystem.uf2`. The UF2 blocks for the
+# filesystem are addressed to the RWW EEPROM at 0x400000; the bootloader has to be one that writes there. Note
+# that flashing the image replaces whatever filesystem the watch had, including anything faces have saved.
+
+import os
+import sys
+import struct
+import argparse
+import subprocess
+import tempfile
+
+TOOL_DIR = os.path.dirname(os.path.abspath(__file__))
+sys.path.insert(0, os.path.dirname(TOOL_DIR))
+import uf2conv
+
+RWW_EEPROM_ADDR = 0x400000
+
+
+def build_image(directory):
+    result = subprocess.run(["make"], cwd=TOOL_DIR, capture_output=True, text=True)
+    if result.returncode:
+        sys.exit(result.stdout + result.stderr)
+
+    with tempfile.NamedTemporaryFile(suffix=".bin", delete=False) as f:
+        path = f.name
+    try:
+        result = subprocess.run([os.path.join(TOOL_DIR, "build-host", "lfs_image"), directory, path],
+                                capture_output=True, text=True)
+        if result.returncode:
+            sys.exit(result.stderr)
+        # the last line is the summary; filesystem.c's chatter about formatting comes before it.
+        print(result.stdout.strip().splitlines()[-1])
+        with open(path, "rb") as f:
+            return f.read()
+    finally:
+        os.unlink(path)
+
+
+def uf2_blocks(buf):
+    """Splits a UF2 file into (flags, address, payload, family) for each of its blocks."""
+    blocks = []
+    for ptr in range(0, len(buf), 512):
+        block = buf[ptr:ptr + 512]
+        hd = struct.unpack("<IIIIIIII", block[0:32])
+        if hd[0] != uf2conv.UF2_MAGIC_START0 or hd[1] != uf2conv.UF2_MAGIC_START1:
+            sys.exit("bad UF2 block at offset %d" % ptr)
+        blocks.append((hd[2], hd[3], block[32:32 + hd[4]], hd[7]))
+    return blocks
+
+
+def encode_uf2(blocks):
+    outp = b""
+    for blockno, (flags, addr, payload, family) in enumerate(blocks):
+        hd = struct.pack("<IIIIIIII", uf2conv.UF2_MAGIC_START0, uf2conv.UF2_MAGIC_START1,
+                         flags, addr, len(payload), blockno, len(blocks), family)
+        block = hd + payload
+        block += b"\x00" * (512 - 4 - len(block))
+        outp += block + struct.pack("<I", uf2conv.UF2_MAGIC_END)
+    return outp
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Builds a LittleFS image of a directory for the watch.")
+    parser.add_argument("directory", help="the files to put on the watch")
+    parser.add_argument("-o", "--output", help='output file (default "filesystem.uf2", or "filesystem.bin" with --bin)')
+    parser.add_argument("-f", "--firmware", metavar="UF2", help="a firmware UF2 to combine the filesystem with")
+    parser.add_argument("--bin", action="store_true", help="write the raw image instead of a UF2")
+    args = parser.parse_args()
+
+    if not os.path.isdir(args.directory):
+        sys.exit("%s is not a directory" % args.directory)
+    image = build_image(args.directory)
+
+    if args.bin:
+        output = args.output or "filesystem.bin"
+        with open(output, "wb") as f:
+            f.write(image)
+        print("wrote %d bytes to %s" % (len(image), output))
+        return 0
+
+    blocks = []
+    family = uf2conv.families["SAML22"]
+    if args.firmware:
+        with open(args.firmware, "rb") as f:
+            blocks = uf2_blocks(f.read())
+        if blocks:
+            family = blocks[0][3]
+    for ptr in range(0, len(image), 256):
+        blocks.append((0x2000 if family else 0, RWW_EEPROM_ADDR + ptr, image[ptr:ptr + 256], family))
+
+    output = args.output or "filesystem.uf2"
+    with open(output, "wb") as f:
+        f.write(encode_uf2(blocks))
+    print("wrote %d blocks to %s" % (len(blocks), output))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,154 @@
+# MIT License
+#
+# Copyright (c) 2026 The Sensor Watch contributors
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to deal
+# in the Software without restriction, including without limitation the rights
+# to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+# copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+# OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+# SOFTWARE.
+
+# Generates the character rendering tables for watch_private_display.c. The build runs this on every change to
+# watch_private_display.h:
+#
+#   python3 segment_tables.py watch_private_display.h watch_display_tables.h
+#
+# For each position on the display, it works out which segments a character there may touch (Display_Clear),
+# and for each printable character which of those segments end up on (Display_Set), with all of the
+# position-specific substitutions below already applied. Display_Set is stored as 16-bit words shifted down by
+# Display_Shift[position], since no position spans more than 16 SEG lines.
+
+import re
+import sys
+
+FIRST_CHARACTER = 0x20
+
+
+def parse_header(path):
+    with open(path) as f:
+        contents = f.read()
+    character_set = re.search(r"Character_Set\[\]\s*=\s*\{(.*?)\};", contents, re.S).group(1)
+    character_set = [int(value, 2) for value in re.findall(r"0b([01]{8})", character_set)]
+    segment_map = re.search(r"Segment_Map\[\]\s*=\s*\{(.*?)\};", contents, re.S).group(1)
+    segment_map = [int(value, 16) for value in re.findall(r"0x([0-9a-fA-F]+)", segment_map)]
+    return character_set, segment_map
+
+
+def substitute(character, position):
+    """Swaps in a character that can actually be drawn at this position; see the comments for each case."""
+    if position == 4 or position == 6:
+        if character == '7': character = '&'  # "lowercase" 7
+        elif character == 'A': character = 'a'  # A needs to be lowercase
+        elif character == 'o': character = 'O'  # O needs to be uppercase
+        elif character == 'L': character = '!'  # L needs to be in top half
+        elif character in "MmN": character = 'n'  # M and uppercase N need to be lowercase n
+        elif character == 'c': character = 'C'  # C needs to be uppercase
+        elif character == 'J': character = 'j'  # same
+        elif character in "vVUWw": character = 'u'  # bottom segment duplicated, so show in top half
+    else:
+        if character == 'u': character = 'v'  # we can use the bottom segment; move to lower half
+        elif character == 'j': character = 'J'  # same but just display a normal J
+    if position > 1:
+        if character == 'T': character = 't'  # uppercase T only works in positions 0 and 1
+    if position == 1:
+        if character == 'a': character = 'A'  # A needs to be uppercase
+        elif character == 'o': character = 'O'  # O needs to be uppercase
+        elif character == 'i': character = 'l'  # I needs to be uppercase (use an l, it looks the same)
+        elif character == 'n': character = 'N'  # N needs to be uppercase
+        elif character == 'r': character = 'R'  # R needs to be uppercase
+        elif character == 'd': character = 'D'  # D needs to be uppercase
+        elif character in "vVu": character = 'U'  # side segments shared, make uppercase
+        elif character == 'b': character = 'B'  # B needs to be uppercase
+        elif character == 'c': character = 'C'  # C needs to be uppercase
+    else:
+        if character == 'R': character = 'r'  # R needs to be lowercase almost everywhere
+    if position != 0:
+        if character == 'I': character = 'l'  # uppercase I only works in position 0
+    return character
+
+
+def render(character, position, character_set, segment_map):
+    """Returns {(com, seg): on} for every segment that drawing this character at this position writes."""
+    character = substitute(character, position)
+    pixels = {}
+    if position == 0:
+        pixels[(0, 15)] = False  # clear funky ninth segment
+
+    # segments that appear twice in the map (the shared ones) take the value of the later bit.
+    segmap = segment_map[position]
+    segdata = character_set[ord(character) - FIRST_CHARACTER]
+    for i in range(8):
+        com = (segmap & 0xFF) >> 6
+        if com <= 2:  # COM3 means no segment exists
+            pixels[(com, segmap & 0x3F)] = bool(segdata & 1)
+        segmap >>= 8
+        segdata >>= 1
+
+    if character == 'T' and position == 1:
+        pixels[(1, 12)] = True  # add descender
+    elif position == 0 and character in "BD@":
+        pixels[(0, 15)] = True  # add funky ninth segment
+    elif position == 1 and character in "BD@":
+        pixels[(0, 12)] = True  # add funky ninth segment
+    return pixels
+
+
+def main(header, output):
+    character_set, segment_map = parse_header(header)
+    characters = [chr(FIRST_CHARACTER + i) for i in range(len(character_set))]
+
+    shifts, clears, sets = [], [], []
+    for position in range(len(segment_map)):
+        rendered = [render(character, position, character_set, segment_map) for character in characters]
+        clear = [0, 0, 0]
+        for pixels in rendered:
+            for com, seg in pixels:
+                clear[com] |= 1 << seg
+        # every character has to write the same segments, or the clear mask would wipe out its neighbours.
+        for pixels in rendered:
+            assert len(pixels) == sum(bin(mask).count("1") for mask in clear), "position %d" % position
+
+        shift = min((mask & -mask).bit_length() - 1 for mask in clear if mask)
+        assert all(mask >> shift < 0x10000 for mask in clear), "position %d spans more than 16 segments" % position
+
+        shifts.append(shift)
+        clears.append(clear)
+        sets.append([[sum(1 << seg for (c, seg), on in pixels.items() if c == com and on) >> shift for com in range(3)]
+                     for pixels in rendered])
+
+    with open(output, "w") as f:
+        f.write("// Generated from watch_private_display.h by utils/segment_tables.py; do not edit.\n\n")
+        f.write("#ifndef _WATCH_DISPLAY_TABLES_H_INCLUDED\n#define _WATCH_DISPLAY_TABLES_H_INCLUDED\n\n")
+        f.write("#define DISPLAY_TABLE_FIRST_CHARACTER 0x%02x\n" % FIRST_CHARACTER)
+        f.write("#define DISPLAY_TABLE_NUM_CHARACTERS %d\n\n" % len(characters))
+        f.write("static const uint8_t Display_Shift[] = { %s };\n\n" % ", ".join(str(shift) for shift in shifts))
+        f.write("static const uint32_t Display_Clear[][3] = {\n")
+        for position, clear in enumerate(clears):
+            f.write("    { 0x%06x, 0x%06x, 0x%06x }, // Position %d\n" % (clear[0], clear[1], clear[2], position))
+        f.write("};\n\n")
+        f.write("static const uint16_t Display_Set[][DISPLAY_TABLE_NUM_CHARACTERS][3] = {\n")
+        for position, table in enumerate(sets):
+            f.write("    { // Position %d\n" % position)
+            for character, words in zip(characters, table):
+                comment = {" ": "space", "\\": "backslash"}.get(character, character)
+                f.write("        { 0x%04x, 0x%04x, 0x%04x }, // %s\n" % (words[0], words[1], words[2], comment))
+            f.write("    },\n")
+        f.write("};\n\n#endif\n")
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        sys.exit("usage: %s watch_private_display.h watch_display_tables.h" % sys.argv[0])
+    main(sys.argv[1], sys.argv[2])
@@ -82,23 +82,21 @@ system_time_t _system_time_get_max_time_value(const void *const hw)
 }
 /**
  * \brief Delay loop to delay n number of cycles
+ *
+ * SysTick is left free-running from 0xFFFFFF, so that watch_get_cycle_count
+ * can read it; rather than reloading it, we count down the cycles that pass.
  */
 void _delay_cycles(void *const hw, uint32_t cycles)
 {
 	(void)hw;
-	uint8_t  n   = cycles >> 24;
-	uint32_t buf = cycles;
+	uint32_t last = SysTick->VAL;
 
-	while (n--) {
-		SysTick->LOAD = 0xFFFFFF;
-		SysTick->VAL  = 0xFFFFFF;
-		while (!(SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk))
-			;
-		buf -= 0xFFFFFF;
+	while (cycles) {
+		uint32_t now     = SysTick->VAL;
+		uint32_t elapsed = (last - now) & SysTick_LOAD_RELOAD_Msk;
+		if (elapsed >= cycles)
+			break;
+		cycles -= elapsed;
+		last = now;
 	}
-
-	SysTick->LOAD = buf;
-	SysTick->VAL  = buf;
-	while (!(SysTick->CTRL & SysTick_CTRL_COUNTFLAG_Msk))
-		;
 }
@@ -79,6 +79,7 @@ int main(void) {
     while (1) {
         bool usb_enabled = hri_usbdevice_get_CTRLA_ENABLE_bit(USB);
         bool can_sleep = app_loop();
+        watch_display_commit();
         if (can_sleep && !usb_enabled) {
             app_prepare_for_standby();
             sleep(4);
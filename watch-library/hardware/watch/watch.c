@@ -51,3 +51,17 @@ void watch_reset_to_bootloader(void) {
     *dbl_tap_ptr = 0xf01669ef; // from the UF2 bootloaer: uf2.h line 255
     NVIC_SystemReset();
 }
+
+void watch_delay_ms(const uint16_t ms) {
+    watch_display_commit();
+    delay_ms(ms);
+}
+
+uint32_t watch_get_cycle_count(void) {
+    // SysTick counts down from 0xFFFFFF at the core clock; flip it so that the count goes up.
+    return SysTick_LOAD_RELOAD_Msk - SysTick->VAL;
+}
+
+uint32_t watch_get_cycles_since(uint32_t start) {
+    return (watch_get_cycle_count() - start) & SysTick_LOAD_RELOAD_Msk;
+}
@@ -176,6 +176,6 @@ void watch_buzzer_play_note(BuzzerNote note, uint16_t duration_ms) {
         watch_set_buzzer_period(NotePeriods[note]);
         watch_set_buzzer_on();
     }
-    delay_ms(duration_ms);
+    watch_delay_ms(duration_ms);
     watch_set_buzzer_off();
 }
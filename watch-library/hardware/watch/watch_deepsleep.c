@@ -151,6 +151,9 @@ static void _watch_disable_all_peripherals_except_slcd(void) {
 }
 
 void watch_enter_sleep_mode(void) {
+    // the display is all we leave on, so make sure it shows what the app last drew.
+    watch_display_commit();
+
     // disable all other peripherals
     _watch_disable_all_peripherals_except_slcd();
 
@@ -30,6 +30,12 @@ ext_irq_cb_t btn_alarm_callback;
 ext_irq_cb_t a2_callback;
 ext_irq_cb_t a4_callback;
 
+// the RTC has no sub-second counter in clock mode, so the timeout counts 128 Hz periodic interrupts instead.
+static volatile uint32_t tick_count;
+static volatile uint16_t timeout_remaining;
+static ext_irq_cb_t timeout_callback;
+static bool tick_128hz_enabled;
+
 bool _watch_rtc_is_enabled(void) {
     return RTC->MODE2.CTRLA.bit.ENABLE;
 }
@@ -91,6 +97,7 @@ void watch_rtc_register_periodic_callback(ext_irq_cb_t callback, uint8_t frequen
 
     // this also maps nicely to an index for our list of tick callbacks.
     tick_callbacks[per_n] = callback;
+    if (per_n == 0) tick_128hz_enabled = true;
 
     NVIC_ClearPendingIRQ(RTC_IRQn);
     NVIC_EnableIRQ(RTC_IRQn);
@@ -100,10 +107,15 @@ void watch_rtc_register_periodic_callback(ext_irq_cb_t callback, uint8_t frequen
 void watch_rtc_disable_periodic_callback(uint8_t frequency) {
     if (__builtin_popcount(frequency) != 1) return;
     uint8_t per_n = __builtin_clz((frequency & 0xFF) << 24);
-    RTC->MODE2.INTENCLR.reg = 1 << per_n;
+    watch_rtc_disable_matching_periodic_callbacks(1 << per_n);
 }
 
 void watch_rtc_disable_matching_periodic_callbacks(uint8_t mask) {
+    if (mask & RTC_MODE2_INTENCLR_PER0) {
+        tick_128hz_enabled = false;
+        // a pending timeout still needs the 128 Hz interrupt, so leave it running; the callback just won't be called.
+        if (timeout_callback != NULL) mask &= ~RTC_MODE2_INTENCLR_PER0;
+    }
     RTC->MODE2.INTENCLR.reg = mask;
 }
 
@@ -111,6 +123,32 @@ void watch_rtc_disable_all_periodic_callbacks(void) {
     watch_rtc_disable_matching_periodic_callbacks(0xFF);
 }
 
+uint32_t watch_rtc_get_ticks(void) {
+    return tick_count;
+}
+
+void watch_rtc_register_timeout_callback(ext_irq_cb_t callback, uint16_t ticks) {
+    timeout_remaining = ticks ? ticks : 1;
+    timeout_callback = callback;
+    NVIC_EnableIRQ(RTC_IRQn);
+    RTC->MODE2.INTENSET.reg = RTC_MODE2_INTENSET_PER0;
+}
+
+void watch_rtc_disable_timeout_callback(void) {
+    timeout_callback = NULL;
+    if (!tick_128hz_enabled) RTC->MODE2.INTENCLR.reg = RTC_MODE2_INTENCLR_PER0;
+}
+
+static void _watch_rtc_handle_128hz_tick(void) {
+    tick_count++;
+    if (timeout_callback != NULL && --timeout_remaining == 0) {
+        ext_irq_cb_t callback = timeout_callback;
+        // clear it before calling out, so the callback can register the next timeout.
+        watch_rtc_disable_timeout_callback();
+        callback();
+    }
+}
+
 void watch_rtc_register_alarm_callback(ext_irq_cb_t callback, watch_date_time alarm_time, watch_rtc_alarm_match mask) {
     RTC->MODE2.Mode2Alarm[0].ALARM.reg = alarm_time.reg;
     RTC->MODE2.Mode2Alarm[0].MASK.reg = mask;
@@ -134,6 +172,13 @@ void RTC_Handler(void) {
         // start from PER7, the 1 Hz tick.
         for(int8_t i = 7; i >= 0; i--) {
             if ((interrupt_status & interrupt_enabled) & (1 << i)) {
+                if (i == 0) {
+                    _watch_rtc_handle_128hz_tick();
+                    if (!tick_128hz_enabled) {
+                        RTC->MODE2.INTFLAG.reg = RTC_MODE2_INTFLAG_PER0;
+                        continue;
+                    }
+                }
                 if (tick_callbacks[i] != NULL) {
                     tick_callbacks[i]();
                 }
@@ -33,23 +33,36 @@ static void _sync_slcd(void) {
     while (SLCD->SYNCBUSY.reg);
 }
 
-void watch_enable_display(void) {
-    SEGMENT_LCD_0_init();
-    slcd_sync_enable(&SEGMENT_LCD_0);
-}
+// The values most recently written to SDATAL0-2, to compare with Segment_Data.
+static uint32_t _slcd_committed[3];
 
-inline void watch_set_pixel(uint8_t com, uint8_t seg) {
-    slcd_sync_seg_on(&SEGMENT_LCD_0, SLCD_SEGID(com, seg));
+static volatile uint32_t *_slcd_data_register(uint8_t com) {
+    // SDATALx and SDATAHx alternate, so the low word for each common is every other register from SDATAL0.
+    return &(&SLCD->SDATAL0.reg)[com * 2];
 }
 
-inline void watch_clear_pixel(uint8_t com, uint8_t seg) {
-    slcd_sync_seg_off(&SEGMENT_LCD_0, SLCD_SEGID(com, seg));
+void watch_enable_display(void) {
+    SEGMENT_LCD_0_init();
+    slcd_sync_enable(&SEGMENT_LCD_0);
+    // init resets the SLCD, which clears SDATA, so the display starts out blank. start our copies out that way too,
+    // rather than read back registers we know are zero.
+    for (uint8_t com = 0; com < 3; com++) Segment_Data[com] = _slcd_committed[com] = 0;
 }
 
-void watch_clear_display(void) {
-    SLCD->SDATAL0.reg = 0;
-    SLCD->SDATAL1.reg = 0;
-    SLCD->SDATAL2.reg = 0;
+void _watch_display_write_segments(void) {
+    uint8_t changed = 0;
+    for (uint8_t com = 0; com < 3; com++) if (Segment_Data[com] != _slcd_committed[com]) changed |= 1 << com;
+    if (!changed) return;
+
+    // the SLCD copies SDATA into its shadow memory at the start of every frame. locking the shadow memory
+    // while we write means that all of the words we change go out together, at the first frame after we unlock.
+    hri_slcd_set_CTRLC_LOCK_bit(SLCD);
+    for (uint8_t com = 0; com < 3; com++) {
+        if (!(changed & (1 << com))) continue;
+        *_slcd_data_register(com) = Segment_Data[com];
+        _slcd_committed[com] = Segment_Data[com];
+    }
+    hri_slcd_clear_CTRLC_LOCK_bit(SLCD);
 }
 
 void watch_start_character_blink(char character, uint32_t duration) {
@@ -0,0 +1,322 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 The Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <getopt.h>
+#include "watch.h"
+#include "watch_utility.h"
+#include "watch_host.h"
+
+// Each pass through app_loop while the app refuses to sleep costs this much virtual time. On hardware the
+// loop just spins until the next interrupt; charging it a fixed cost keeps "awake" time meaningful.
+#define WATCH_HOST_ACTIVE_LOOP_NS (1 * WATCH_HOST_NSEC_PER_MSEC)
+
+#define WATCH_HOST_MAX_SCRIPT_STEPS (4096)
+
+typedef enum {
+    SCRIPT_STEP_PIN_HIGH = 0,
+    SCRIPT_STEP_PIN_LOW,
+    SCRIPT_STEP_PRINT,
+} watch_host_script_action_t;
+
+typedef struct {
+    uint64_t time_ns;
+    watch_host_script_action_t action;
+    uint8_t pin;
+} watch_host_script_step_t;
+
+static watch_host_script_step_t script[WATCH_HOST_MAX_SCRIPT_STEPS];
+static size_t script_length = 0;
+static size_t script_position = 0;
+static bool verbose = false;
+static struct timespec wall_clock_start;
+
+static void print_display(void) {
+    char buf[40];
+    watch_date_time date_time = watch_rtc_get_date_time();
+    uint64_t now = watch_host_get_time_ns();
+
+    watch_host_get_display(buf);
+    printf("%04d-%02d-%02d %02d:%02d:%02d.%03d  [%s]\n",
+           date_time.unit.year + WATCH_RTC_REFERENCE_YEAR, date_time.unit.month, date_time.unit.day,
+           date_time.unit.hour, date_time.unit.minute, date_time.unit.second,
+           (int)((now % WATCH_HOST_NSEC_PER_SEC) / WATCH_HOST_NSEC_PER_MSEC), buf);
+}
+
+static void print_energy(void) {
+    static const char *names[] = {
+        "active", "standby", "sleep",
+        "red LED", "green LED", "buzzer", "ADC", "I2C", "SPI",
+        "wakeups", "LCD segments",
+    };
+    double breakdown[sizeof(names) / sizeof(names[0])];
+    double average = watch_host_get_average_current(breakdown);
+
+    printf("estimated current: %10.3f uA average\n", average);
+    for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+        if (breakdown[i] >= 0.0005) printf("  %-16s %10.3f uA\n", names[i], breakdown[i]);
+    }
+}
+
+static void print_report(void) {
+    struct timespec wall_clock_end;
+    watch_host_stats_t *stats = watch_host_get_stats();
+    double simulated = (double)watch_host_get_time_ns() / WATCH_HOST_NSEC_PER_SEC;
+
+    clock_gettime(CLOCK_MONOTONIC, &wall_clock_end);
+    double elapsed = (wall_clock_end.tv_sec - wall_clock_start.tv_sec) + (wall_clock_end.tv_nsec - wall_clock_start.tv_nsec) / 1e9;
+
+    print_display();
+    printf("simulated %.0f s in %.3f s\n", simulated, elapsed);
+    printf("app_loop calls:    %llu\n", (unsigned long long)stats->app_loops);
+    printf("active:            %12.3f s, %llu wakeups\n", (double)stats->time_ns[WATCH_HOST_POWER_ACTIVE] / WATCH_HOST_NSEC_PER_SEC,
+           (unsigned long long)stats->wakeups[WATCH_HOST_POWER_ACTIVE]);
+    printf("standby:           %12.3f s, %llu wakeups\n", (double)stats->time_ns[WATCH_HOST_POWER_STANDBY] / WATCH_HOST_NSEC_PER_SEC,
+           (unsigned long long)stats->wakeups[WATCH_HOST_POWER_STANDBY]);
+    printf("sleep:             %12.3f s, %llu wakeups\n", (double)stats->time_ns[WATCH_HOST_POWER_SLEEP] / WATCH_HOST_NSEC_PER_SEC,
+           (unsigned long long)stats->wakeups[WATCH_HOST_POWER_SLEEP]);
+    printf("SLCD writes:       %12.3f per second\n", stats->slcd_register_writes / simulated);
+    printf("storage:           %12.3f s busy, %llu reads, %llu page writes, %llu row erases\n",
+           (double)stats->storage_busy_ns / WATCH_HOST_NSEC_PER_SEC, (unsigned long long)stats->storage_reads,
+           (unsigned long long)stats->storage_page_writes, (unsigned long long)stats->storage_row_erases);
+    printf("i2c:               %12.3f s busy, %llu transactions, %llu bytes\n",
+           (double)stats->i2c_busy_ns / WATCH_HOST_NSEC_PER_SEC, (unsigned long long)stats->i2c_transactions,
+           (unsigned long long)stats->i2c_bytes);
+    printf("spi:               %12.3f s busy, %llu calls, %llu bytes, %llu flash page programs, %llu sector erases\n",
+           (double)stats->spi_busy_ns / WATCH_HOST_NSEC_PER_SEC, (unsigned long long)stats->spi_calls,
+           (unsigned long long)stats->spi_bytes, (unsigned long long)stats->spi_flash_page_programs,
+           (unsigned long long)stats->spi_flash_sector_erases);
+    print_energy();
+}
+
+static void run_script_step(void *user_data) {
+    (void) user_data;
+
+    uint64_t now = watch_host_get_time_ns();
+    while (script_position < script_length && script[script_position].time_ns <= now) {
+        watch_host_script_step_t *step = &script[script_position++];
+        switch (step->action) {
+            case SCRIPT_STEP_PIN_HIGH:
+                watch_host_set_pin_level(step->pin, true);
+                break;
+            case SCRIPT_STEP_PIN_LOW:
+                watch_host_set_pin_level(step->pin, false);
+                break;
+            case SCRIPT_STEP_PRINT:
+                print_display();
+                break;
+        }
+    }
+
+    if (script_position < script_length) {
+        watch_host_set_peripheral_timer(run_script_step, NULL, script[script_position].time_ns - now, 0);
+    }
+}
+
+// durations look like 250ms, 10s, 5m, 2h or 30d; a bare number is in seconds.
+static bool parse_duration(const char *s, uint64_t *duration_ns) {
+    char *end;
+    double value = strtod(s, &end);
+    uint64_t unit = WATCH_HOST_NSEC_PER_SEC;
+
+    if (end == s || value < 0) return false;
+    if (!strcmp(end, "ms")) unit = WATCH_HOST_NSEC_PER_MSEC;
+    else if (!strcmp(end, "s") || *end == 0) unit = WATCH_HOST_NSEC_PER_SEC;
+    else if (!strcmp(end, "m")) unit = 60 * WATCH_HOST_NSEC_PER_SEC;
+    else if (!strcmp(end, "h")) unit = 3600 * WATCH_HOST_NSEC_PER_SEC;
+    else if (!strcmp(end, "d")) unit = 86400 * WATCH_HOST_NSEC_PER_SEC;
+    else return false;
+
+    *duration_ns = (uint64_t)(value * unit);
+    return true;
+}
+
+static bool parse_button(const char *s, uint8_t *pin) {
+    if (!strcasecmp(s, "light")) *pin = BTN_LIGHT;
+    else if (!strcasecmp(s, "mode")) *pin = BTN_MODE;
+    else if (!strcasecmp(s, "alarm")) *pin = BTN_ALARM;
+    else return false;
+
+    return true;
+}
+
+static bool add_script_step(uint64_t time_ns, watch_host_script_action_t action, uint8_t pin) {
+    if (script_length >= WATCH_HOST_MAX_SCRIPT_STEPS) return false;
+    script[script_length].time_ns = time_ns;
+    script[script_length].action = action;
+    script[script_length].pin = pin;
+    script_length++;
+    return true;
+}
+
+// Scripts are a list of commands, one per line:
+//   wait DURATION             let time pass
+//   press BUTTON [DURATION]   press and release light, mode or alarm (held for 100ms by default)
+//   down BUTTON / up BUTTON   press or release a button
+//   print                     print the display
+// Anything after a # is a comment.
+static bool load_script(const char *filename) {
+    FILE *f = fopen(filename, "r");
+    char line[256];
+    unsigned line_number = 0;
+    uint64_t cursor = 0;
+
+    if (f == NULL) {
+        perror(filename);
+        return false;
+    }
+
+    while (fgets(line, sizeof(line), f)) {
+        char *comment = strchr(line, '#');
+        char *command, *arg1, *arg2;
+        uint64_t duration = 100 * WATCH_HOST_NSEC_PER_MSEC;
+        uint8_t pin = 0;
+        bool ok = true;
+
+        line_number++;
+        if (comment) *comment = 0;
+        command = strtok(line, " \t\r\n");
+        if (command == NULL) continue;
+        arg1 = strtok(NULL, " \t\r\n");
+        arg2 = strtok(NULL, " \t\r\n");
+
+        if (!strcmp(command, "wait")) {
+            ok = arg1 && parse_duration(arg1, &duration);
+            cursor += duration;
+        } else if (!strcmp(command, "press")) {
+            ok = arg1 && parse_button(arg1, &pin) && (arg2 == NULL || parse_duration(arg2, &duration));
+            ok = ok && add_script_step(cursor, SCRIPT_STEP_PIN_HIGH, pin);
+            cursor += duration;
+            ok = ok && add_script_step(cursor, SCRIPT_STEP_PIN_LOW, pin);
+        } else if (!strcmp(command, "down") || !strcmp(command, "up")) {
+            ok = arg1 && parse_button(arg1, &pin);
+            ok = ok && add_script_step(cursor, command[0] == 'd' ? SCRIPT_STEP_PIN_HIGH : SCRIPT_STEP_PIN_LOW, pin);
+        } else if (!strcmp(command, "print")) {
+            ok = add_script_step(cursor, SCRIPT_STEP_PRINT, 0);
+        } else {
+            ok = false;
+        }
+
+        if (!ok) {
+            fprintf(stderr, "%s:%u: can't parse this line\n", filename, line_number);
+            fclose(f);
+            return false;
+        }
+    }
+
+    fclose(f);
+    return true;
+}
+
+static bool parse_date_time(const char *s, watch_date_time *date_time) {
+    unsigned year, month, day, hour = 0, minute = 0, second = 0;
+
+    if (sscanf(s, "%u-%u-%uT%u:%u:%u", &year, &month, &day, &hour, &minute, &second) < 3) return false;
+    if (year < WATCH_RTC_REFERENCE_YEAR || year > WATCH_RTC_REFERENCE_YEAR + 63) return false;
+    date_time->unit.year = year - WATCH_RTC_REFERENCE_YEAR;
+    date_time->unit.month = month;
+    date_time->unit.day = day;
+    date_time->unit.hour = hour;
+    date_time->unit.minute = minute;
+    date_time->unit.second = second;
+
+    return true;
+}
+
+static void usage(const char *name) {
+    fprintf(stderr, "usage: %s [-d YYYY-MM-DDTHH:MM:SS] [-t DURATION] [-s SCRIPT] [-v]\n", name);
+    fprintf(stderr, "  -d  date and time to start at (default 2023-01-01T00:00:00)\n");
+    fprintf(stderr, "  -t  how much virtual time to run for, i.e. 90s, 12h, 30d (default 1d)\n");
+    fprintf(stderr, "  -s  a script of button presses to replay\n");
+    fprintf(stderr, "  -v  print the display every time it changes\n");
+}
+
+int main(int argc, char *argv[]) {
+    watch_date_time start_time = {0};
+    uint64_t run_time = 86400 * WATCH_HOST_NSEC_PER_SEC;
+    int opt;
+
+    // same as the hardware's power-on default
+    start_time.unit.year = 3;
+    start_time.unit.month = 1;
+    start_time.unit.day = 1;
+
+    while ((opt = getopt(argc, argv, "d:t:s:vh")) != -1) {
+        switch (opt) {
+            case 'd':
+                if (!parse_date_time(optarg, &start_time)) {
+                    usage(argv[0]);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 't':
+                if (!parse_duration(optarg, &run_time)) {
+                    usage(argv[0]);
+                    return EXIT_FAILURE;
+                }
+                break;
+            case 's':
+                if (!load_script(optarg)) return EXIT_FAILURE;
+                break;
+            case 'v':
+                verbose = true;
+                break;
+            default:
+                usage(argv[0]);
+                return EXIT_FAILURE;
+        }
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &wall_clock_start);
+    watch_host_set_end_time(run_time);
+    atexit(print_report);
+
+    app_init();
+    _watch_init();
+    watch_rtc_set_date_time(start_time);
+    app_setup();
+
+    if (script_length) watch_host_set_peripheral_timer(run_script_step, NULL, script[0].time_ns, 0);
+
+    while (1) {
+        watch_host_get_stats()->app_loops++;
+        bool can_sleep = app_loop();
+        watch_display_commit();
+        if (verbose && watch_host_display_changed()) print_display();
+        if (can_sleep) {
+            app_prepare_for_standby();
+            watch_host_wait_for_interrupt(WATCH_HOST_POWER_STANDBY);
+            app_wake_from_standby();
+        } else {
+            watch_host_advance(WATCH_HOST_ACTIVE_LOOP_NS);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,145 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 The Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "watch_buzzer.h"
+#include "watch_private_buzzer.h"
+#include "watch_private.h"
+#include "watch_host.h"
+
+static bool buzzer_on = false;
+static uint32_t buzzer_period;
+
+static void cb_watch_buzzer_seq(void *user_data);
+
+static uint16_t _seq_position;
+static int8_t _tone_ticks, _repeat_counter;
+static int8_t _seq_timer_id = -1;
+static int8_t *_sequence;
+static void (*_cb_finished)(void);
+
+static inline void _seq_timer_stop(void) {
+    watch_host_clear_timer(_seq_timer_id);
+    _seq_timer_id = -1;
+}
+
+void watch_buzzer_play_sequence(int8_t *note_sequence, void (*callback_on_end)(void)) {
+    if (_seq_timer_id != -1) _seq_timer_stop();
+    watch_set_buzzer_off();
+    _sequence = note_sequence;
+    _cb_finished = callback_on_end;
+    _seq_position = 0;
+    _tone_ticks = 0;
+    _repeat_counter = -1;
+    // prepare buzzer
+    watch_enable_buzzer();
+    // initiate 64 hz callback
+    _seq_timer_id = watch_host_set_timer(cb_watch_buzzer_seq, NULL, WATCH_HOST_NSEC_PER_SEC / 64, WATCH_HOST_NSEC_PER_SEC / 64);
+}
+
+static void cb_watch_buzzer_seq(void *user_data) {
+    // callback for reading the note sequence
+    (void) user_data;
+    if (_tone_ticks == 0) {
+        if (_sequence[_seq_position] < 0 && _sequence[_seq_position + 1]) {
+            // repeat indicator found
+            if (_repeat_counter == -1) {
+                // first encounter: load repeat counter
+                _repeat_counter = _sequence[_seq_position + 1];
+            } else _repeat_counter--;
+            if (_repeat_counter > 0) {
+                // rewind
+                if (_seq_position > _sequence[_seq_position] * -2)
+                    _seq_position += _sequence[_seq_position] * 2;
+                else
+                    _seq_position = 0;
+            } else {
+                // continue
+                _seq_position += 2;
+                _repeat_counter = -1;
+            }
+        }
+        if (_sequence[_seq_position] && _sequence[_seq_position + 1]) {
+            // read note
+            BuzzerNote note = _sequence[_seq_position];
+            if (note == BUZZER_NOTE_REST) {
+                watch_set_buzzer_off();
+            } else {
+                watch_set_buzzer_period(NotePeriods[note]);
+                watch_set_buzzer_on();
+            }
+            // set duration ticks and move to next tone
+            _tone_ticks = _sequence[_seq_position + 1];
+            _seq_position += 2;
+        } else {
+            // end the sequence
+            watch_buzzer_abort_sequence();
+            if (_cb_finished) _cb_finished();
+        }
+    } else _tone_ticks--;
+}
+
+void watch_buzzer_abort_sequence(void) {
+    // ends/aborts the sequence
+    if (_seq_timer_id != -1) _seq_timer_stop();
+    watch_set_buzzer_off();
+}
+
+void watch_enable_buzzer(void) {
+    if (!watch_is_buzzer_or_led_enabled()) _watch_enable_tcc();
+    buzzer_period = NotePeriods[BUZZER_NOTE_A4];
+}
+
+void watch_set_buzzer_period(uint32_t period) {
+    if (!watch_is_buzzer_or_led_enabled()) return;
+    buzzer_period = period;
+}
+
+void watch_disable_buzzer(void) {
+    _watch_disable_tcc();
+    buzzer_period = NotePeriods[BUZZER_NOTE_A4];
+}
+
+void watch_set_buzzer_on(void) {
+    if (!watch_is_buzzer_or_led_enabled()) return;
+    buzzer_on = true;
+    watch_host_set_load(WATCH_HOST_LOAD_BUZZER, 255);
+}
+
+void watch_set_buzzer_off(void) {
+    buzzer_on = false;
+    watch_host_set_load(WATCH_HOST_LOAD_BUZZER, 0);
+}
+
+void watch_buzzer_play_note(BuzzerNote note, uint16_t duration_ms) {
+    if (note == BUZZER_NOTE_REST) {
+        watch_set_buzzer_off();
+    } else {
+        watch_set_buzzer_period(NotePeriods[note]);
+        watch_set_buzzer_on();
+    }
+
+    watch_delay_ms(duration_ms);
+    watch_set_buzzer_off();
+}
@@ -0,0 +1,92 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 The Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "watch_extint.h"
+#include "watch_private.h"
+#include "watch_host.h"
+
+static uint32_t watch_backup_data[8];
+
+void watch_register_extwake_callback(uint8_t pin, ext_irq_cb_t callback, bool level) {
+    if (pin == BTN_ALARM) {
+        _watch_host_register_extwake_callback(pin, callback, level);
+    }
+}
+
+void watch_disable_extwake_interrupt(uint8_t pin) {
+    if (pin == BTN_ALARM) {
+        _watch_host_register_extwake_callback(pin, NULL, false);
+    }
+}
+
+void watch_store_backup_data(uint32_t data, uint8_t reg) {
+    if (reg < 8) {
+        watch_backup_data[reg] = data;
+    }
+}
+
+uint32_t watch_get_backup_data(uint8_t reg) {
+    if (reg < 8) {
+        return watch_backup_data[reg];
+    }
+
+    return 0;
+}
+
+void watch_enter_sleep_mode(void) {
+    // the display is all we leave on, so make sure it shows what the app last drew.
+    watch_display_commit();
+
+    // disable tick interrupt
+    watch_rtc_disable_all_periodic_callbacks();
+
+    // the display is the only peripheral that stays on; among other things, this turns off the buzzer and LEDs.
+    _watch_disable_tcc();
+
+    // enter standby (4); we basically hang out here until an interrupt wakes us.
+    watch_host_wait_for_interrupt(WATCH_HOST_POWER_SLEEP);
+
+    // call app_setup so the app can re-enable everything we disabled.
+    app_setup();
+
+    // and call app_wake_from_standby (since main won't have a chance to do it)
+    app_wake_from_standby();
+}
+
+void watch_enter_deep_sleep_mode(void) {
+    // identical to sleep mode except we disable the LCD first.
+    watch_clear_display();
+
+    watch_enter_sleep_mode();
+}
+
+void watch_enter_backup_mode(void) {
+    watch_rtc_disable_all_periodic_callbacks();
+    watch_rtc_disable_alarm_callback();
+
+    // go into backup sleep mode (5). when we exit, the reset controller will take over.
+    // there is no reset controller here, so we just sleep until the end of the run.
+    while (true) watch_host_wait_for_interrupt(WATCH_HOST_POWER_SLEEP);
+}
@@ -0,0 +1,98 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 The Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "watch_extint.h"
+#include "watch_host.h"
+
+#define WATCH_HOST_NUM_EXTINT 8
+
+typedef struct {
+    uint8_t pin;
+    ext_irq_cb_t callback;
+    watch_interrupt_trigger trigger;
+} watch_host_extint_t;
+
+static bool external_interrupt_enabled = false;
+static watch_host_extint_t external_interrupts[WATCH_HOST_NUM_EXTINT];
+static uint8_t num_external_interrupts = 0;
+
+static uint8_t extwake_pin = 0xFF;
+static ext_irq_cb_t extwake_callback = NULL;
+static bool extwake_level;
+
+void watch_enable_external_interrupts(void) {
+    external_interrupt_enabled = true;
+}
+
+void watch_disable_external_interrupts(void) {
+    external_interrupt_enabled = false;
+}
+
+void watch_register_interrupt_callback(const uint8_t pin, ext_irq_cb_t callback, watch_interrupt_trigger trigger) {
+    for (uint8_t i = 0; i < num_external_interrupts; i++) {
+        if (external_interrupts[i].pin == pin) {
+            external_interrupts[i].callback = callback;
+            external_interrupts[i].trigger = trigger;
+            return;
+        }
+    }
+    if (num_external_interrupts < WATCH_HOST_NUM_EXTINT) {
+        external_interrupts[num_external_interrupts].pin = pin;
+        external_interrupts[num_external_interrupts].callback = callback;
+        external_interrupts[num_external_interrupts].trigger = trigger;
+        num_external_interrupts++;
+    }
+}
+
+void _watch_host_register_extwake_callback(uint8_t pin, void (*callback)(void), bool level) {
+    extwake_pin = pin;
+    extwake_callback = callback;
+    extwake_level = level;
+}
+
+void watch_host_set_pin_level(uint8_t pin, bool level) {
+    if (watch_get_pin_level(pin) == level) return;
+    watch_set_pin_level(pin, level);
+
+    // in sleep mode, the EIC is off and only the RTC's tamper input can wake us.
+    if (watch_host_get_power_state() == WATCH_HOST_POWER_SLEEP) {
+        if (pin == extwake_pin && level == extwake_level) {
+            watch_host_raise_interrupt();
+            if (extwake_callback) extwake_callback();
+        }
+        return;
+    }
+
+    if (!external_interrupt_enabled) return;
+
+    watch_interrupt_trigger event = level ? INTERRUPT_TRIGGER_RISING : INTERRUPT_TRIGGER_FALLING;
+    for (uint8_t i = 0; i < num_external_interrupts; i++) {
+        if (external_interrupts[i].pin == pin && external_interrupts[i].callback && (external_interrupts[i].trigger & event)) {
+            watch_host_raise_interrupt();
+            external_interrupts[i].callback();
+            return;
+        }
+    }
+}
@@ -0,0 +1,213 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 The Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <stdlib.h>
+#include "watch_host.h"
+
+typedef struct {
+    watch_host_timer_cb callback;
+    void *user_data;
+    uint64_t deadline;
+    uint64_t period;
+    bool armed;
+    bool wakes_core;
+} watch_host_timer_t;
+
+static watch_host_timer_t _timers[WATCH_HOST_MAX_TIMERS];
+static uint64_t _now = 0;
+static uint64_t _end_time = UINT64_MAX;
+static watch_host_power_state_t _power_state = WATCH_HOST_POWER_ACTIVE;
+static watch_host_stats_t _stats;
+static bool _interrupt_pending = false;
+static uint8_t _load_duty[WATCH_HOST_NUM_LOADS];
+
+static watch_host_energy_model_t _energy_model = {
+    .power_state_ua = {
+        [WATCH_HOST_POWER_ACTIVE] = 160,    // about 40 µA/MHz at 4 MHz
+        [WATCH_HOST_POWER_STANDBY] = 1.8,   // RTC and LCD running, RAM retained
+        [WATCH_HOST_POWER_SLEEP] = 1.6,     // the same, with the buttons' interrupts off
+    },
+    .load_ua = {
+        [WATCH_HOST_LOAD_LED_RED] = 3000,
+        [WATCH_HOST_LOAD_LED_GREEN] = 3000,
+        [WATCH_HOST_LOAD_BUZZER] = 1500,
+        [WATCH_HOST_LOAD_ADC] = 250,
+        [WATCH_HOST_LOAD_I2C] = 150,
+        [WATCH_HOST_LOAD_SPI] = 150,
+    },
+    .wakeup_nc = 10,                        // about 60 µs of the active current
+    .segment_toggle_nc = 2,
+};
+
+uint64_t watch_host_get_time_ns(void) {
+    return _now;
+}
+
+static int8_t _set_timer(watch_host_timer_cb callback, void *user_data, uint64_t delay_ns, uint64_t period_ns, bool wakes_core) {
+    for (int8_t i = 0; i < WATCH_HOST_MAX_TIMERS; i++) {
+        if (!_timers[i].armed) {
+            _timers[i].callback = callback;
+            _timers[i].user_data = user_data;
+            _timers[i].deadline = _now + delay_ns;
+            _timers[i].period = period_ns;
+            _timers[i].armed = true;
+            _timers[i].wakes_core = wakes_core;
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+int8_t watch_host_set_timer(watch_host_timer_cb callback, void *user_data, uint64_t delay_ns, uint64_t period_ns) {
+    return _set_timer(callback, user_data, delay_ns, period_ns, true);
+}
+
+int8_t watch_host_set_peripheral_timer(watch_host_timer_cb callback, void *user_data, uint64_t delay_ns, uint64_t period_ns) {
+    return _set_timer(callback, user_data, delay_ns, period_ns, false);
+}
+
+void watch_host_raise_interrupt(void) {
+    _interrupt_pending = true;
+}
+
+void watch_host_clear_timer(int8_t timer_id) {
+    if (timer_id < 0 || timer_id >= WATCH_HOST_MAX_TIMERS) return;
+    _timers[timer_id].armed = false;
+}
+
+static int8_t _next_timer(void) {
+    int8_t next = -1;
+    for (int8_t i = 0; i < WATCH_HOST_MAX_TIMERS; i++) {
+        if (_timers[i].armed && (next < 0 || _timers[i].deadline < _timers[next].deadline)) next = i;
+    }
+
+    return next;
+}
+
+static void _fire_timers_due(void) {
+    // fire everything that is due right now, in timer order. a callback may arm or clear
+    // other timers, so we rescan the table after each one.
+    int8_t i;
+    while ((i = _next_timer()) >= 0 && _timers[i].deadline <= _now) {
+        watch_host_timer_t *timer = &_timers[i];
+        if (timer->period) timer->deadline += timer->period;
+        else timer->armed = false;
+        if (timer->wakes_core) _interrupt_pending = true;
+        timer->callback(timer->user_data);
+    }
+}
+
+static void _account_until(uint64_t time_ns) {
+    uint64_t elapsed = time_ns - _now;
+
+    _stats.time_ns[_power_state] += elapsed;
+    for (uint8_t i = 0; i < WATCH_HOST_NUM_LOADS; i++) {
+        if (_load_duty[i]) _stats.load_ns[i] += elapsed * _load_duty[i] / 255;
+    }
+    _now = time_ns;
+}
+
+static void _move_clock_to(uint64_t time_ns) {
+    if (time_ns >= _end_time) {
+        _account_until(_end_time);
+        exit(EXIT_SUCCESS);
+    }
+    _account_until(time_ns);
+}
+
+void watch_host_advance(uint64_t duration_ns) {
+    uint64_t target = _now + duration_ns;
+    int8_t i;
+    while ((i = _next_timer()) >= 0 && _timers[i].deadline <= target) {
+        if (_timers[i].deadline > _now) _move_clock_to(_timers[i].deadline);
+        _fire_timers_due();
+    }
+    _move_clock_to(target);
+}
+
+void watch_host_wait_for_interrupt(watch_host_power_state_t state) {
+    watch_host_power_state_t previous_state = _power_state;
+    int8_t i;
+
+    _power_state = state;
+    _interrupt_pending = false;
+    while (!_interrupt_pending) {
+        // with nothing left to wake us, we would sleep forever; skip straight to the end of the run.
+        i = _next_timer();
+        _move_clock_to(i < 0 ? _end_time : (_timers[i].deadline > _now ? _timers[i].deadline : _now));
+        _fire_timers_due();
+    }
+    _stats.wakeups[state]++;
+    _power_state = previous_state;
+}
+
+watch_host_power_state_t watch_host_get_power_state(void) {
+    return _power_state;
+}
+
+void watch_host_set_end_time(uint64_t time_ns) {
+    _end_time = time_ns;
+}
+
+watch_host_stats_t *watch_host_get_stats(void) {
+    return &_stats;
+}
+
+void watch_host_set_load(watch_host_load_t load, uint8_t duty) {
+    _load_duty[load] = duty;
+}
+
+watch_host_energy_model_t *watch_host_get_energy_model(void) {
+    return &_energy_model;
+}
+
+double watch_host_get_average_current(double *breakdown) {
+    double shares[WATCH_HOST_NUM_POWER_STATES + WATCH_HOST_NUM_LOADS + 2];
+    double seconds = (double)_now / WATCH_HOST_NSEC_PER_SEC;
+    double total = 0;
+    uint8_t n = 0;
+    uint64_t wakeups = 0;
+
+    if (_now == 0) return 0;
+
+    // µA times seconds is µC; divide the charge for each thing by the length of the run.
+    for (uint8_t i = 0; i < WATCH_HOST_NUM_POWER_STATES; i++) {
+        shares[n++] = _energy_model.power_state_ua[i] * _stats.time_ns[i] / _now;
+        wakeups += _stats.wakeups[i];
+    }
+    for (uint8_t i = 0; i < WATCH_HOST_NUM_LOADS; i++) {
+        shares[n++] = _energy_model.load_ua[i] * _stats.load_ns[i] / _now;
+    }
+    shares[n++] = _energy_model.wakeup_nc / 1000 * wakeups / seconds;
+    shares[n++] = _energy_model.segment_toggle_nc / 1000 * _stats.segment_toggles / seconds;
+
+    for (uint8_t i = 0; i < n; i++) {
+        total += shares[i];
+        if (breakdown) breakdown[i] = shares[i];
+    }
+
+    return total;
+}
@@ -0,0 +1,248 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 The Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#ifndef _WATCH_HOST_H_INCLUDED
+#define _WATCH_HOST_H_INCLUDED
+////< @file watch_host.h
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/** @addtogroup host Native Host Backend
+  * @brief This section covers functions specific to the native (Linux) build of the watch library.
+  * @details The host backend runs Movement and its watch faces as a plain executable. Instead of wall clock
+  *          time, everything runs against a virtual clock: the RTC, the buzzer sequencer and the display
+  *          animations are all timers on one virtual timeline, and whenever the app would go to sleep, the
+  *          clock simply jumps ahead to the next timer that is due. This lets us replay weeks of wear in a
+  *          few seconds, with every tick, alarm and low energy update happening exactly as it would on the
+  *          watch. Nothing in this header exists on hardware or in the emscripten simulator; watch faces
+  *          should never need it.
+  */
+/// @{
+
+#define WATCH_HOST_NSEC_PER_SEC (1000000000ULL)
+#define WATCH_HOST_NSEC_PER_MSEC (1000000ULL)
+
+/// The maximum number of virtual timers that can be armed at once.
+#define WATCH_HOST_MAX_TIMERS (16)
+
+/// How long the emulated RWW EEPROM takes to read a halfword (a few cycles at 4 MHz, with the loop around it),
+/// and to write a page or erase a row (the maximum programming times in the SAM L22 datasheet).
+#define WATCH_HOST_STORAGE_READ_NS (1000ULL)
+#define WATCH_HOST_STORAGE_PAGE_WRITE_NS (2500000ULL)
+#define WATCH_HOST_STORAGE_ROW_ERASE_NS (6000000ULL)
+
+/// How long the I2C bus takes per bit, at the 100 kHz it runs at on the watch.
+#define WATCH_HOST_I2C_NS_PER_BIT (10000ULL)
+
+/// How long the SPI bus takes per byte, at the 1 MHz it runs at on the watch, and the time each call into ASF's
+/// synchronous SPI driver costs on top of that at 4 MHz (a rough figure).
+#define WATCH_HOST_SPI_NS_PER_BYTE (8000ULL)
+#define WATCH_HOST_SPI_CALL_NS (20000ULL)
+
+/// The SPI flash on the sensor boards: its size, and how long it takes to program a page, erase a 4 KB sector,
+/// or erase the whole chip (typical figures for a Winbond W25Q16).
+#define WATCH_HOST_SPI_FLASH_SIZE (2UL * 1024 * 1024)
+#define WATCH_HOST_SPI_FLASH_PAGE_PROGRAM_NS (400000ULL)
+#define WATCH_HOST_SPI_FLASH_SECTOR_ERASE_NS (45000000ULL)
+#define WATCH_HOST_SPI_FLASH_CHIP_ERASE_NS (5000000000ULL)
+
+/// @brief The power states the host backend keeps track of.
+typedef enum {
+    WATCH_HOST_POWER_ACTIVE = 0,    // app_loop is running, or the app asked to stay awake.
+    WATCH_HOST_POWER_STANDBY,       // app_loop returned true and main is waiting for the next interrupt.
+    WATCH_HOST_POWER_SLEEP,         // the app called watch_enter_sleep_mode (Movement's low energy mode).
+    WATCH_HOST_NUM_POWER_STATES
+} watch_host_power_state_t;
+
+/// @brief The things besides the core that the energy model charges for while they are on.
+typedef enum {
+    WATCH_HOST_LOAD_LED_RED = 0,
+    WATCH_HOST_LOAD_LED_GREEN,
+    WATCH_HOST_LOAD_BUZZER,
+    WATCH_HOST_LOAD_ADC,
+    WATCH_HOST_LOAD_I2C,
+    WATCH_HOST_LOAD_SPI,
+    WATCH_HOST_NUM_LOADS
+} watch_host_load_t;
+
+/// @brief Counters collected over the course of a run.
+typedef struct {
+    uint64_t app_loops;                                     // number of passes through app_loop
+    uint64_t wakeups[WATCH_HOST_NUM_POWER_STATES];          // interrupts serviced, by the state they woke us from
+    uint64_t time_ns[WATCH_HOST_NUM_POWER_STATES];          // virtual time spent in each power state
+    uint64_t load_ns[WATCH_HOST_NUM_LOADS];                 // virtual time each load was on, weighted by its duty cycle
+    uint64_t segment_toggles;                               // LCD segments turned on or off
+    uint64_t slcd_register_writes;                          // SLCD data registers written by watch_display_commit
+    uint64_t storage_reads;                                 // calls to watch_storage_read
+    uint64_t storage_bytes_read;                            // bytes read by them
+    uint64_t storage_page_writes;                           // pages written to the RWW EEPROM
+    uint64_t storage_row_erases;                            // rows erased in the RWW EEPROM
+    uint64_t storage_busy_ns;                               // virtual time spent reading or waiting on the RWW EEPROM
+    uint64_t i2c_transactions;                              // I2C sends and receives
+    uint64_t i2c_bytes;                                     // data bytes they moved, not counting addresses
+    uint64_t i2c_busy_ns;                                   // virtual time the I2C bus was busy
+    uint64_t spi_calls;                                     // calls to watch_spi_write, watch_spi_read and watch_spi_transfer
+    uint64_t spi_bytes;                                     // bytes they moved
+    uint64_t spi_busy_ns;                                   // virtual time spent in them
+    uint64_t spi_flash_commands;                            // commands sent to the SPI flash, i.e. times it was selected
+    uint64_t spi_flash_page_programs;                       // pages programmed in the SPI flash
+    uint64_t spi_flash_sector_erases;                       // sectors erased in the SPI flash
+} watch_host_stats_t;
+
+/** @brief What the energy model charges for each thing it counts.
+  * @details These are ballpark figures for a Sensor Watch at 3 V, taken from the SAM L22 datasheet where it
+  *          has them. They are good for comparing two runs, not for predicting battery life to the week.
+  */
+typedef struct {
+    double power_state_ua[WATCH_HOST_NUM_POWER_STATES];     // the core, RTC and LCD, by power state
+    double load_ua[WATCH_HOST_NUM_LOADS];                   // each load, at 100% duty
+    double wakeup_nc;                                       // waking from standby to service an interrupt, in nC
+    double segment_toggle_nc;                               // charging or discharging one LCD segment, in nC
+} watch_host_energy_model_t;
+
+typedef void (*watch_host_timer_cb)(void *user_data);
+
+/** @brief Returns the virtual time since the watch was powered on, in nanoseconds.
+  */
+uint64_t watch_host_get_time_ns(void);
+
+/** @brief Arms a timer on the virtual timeline. When it fires, it counts as an interrupt: it wakes the core
+  *        from watch_host_wait_for_interrupt.
+  * @param callback The function to call when the timer fires. It runs in "interrupt context", i.e. from
+  *                 whatever delay or sleep was advancing the clock at the time.
+  * @param user_data A pointer passed through to the callback.
+  * @param delay_ns How far in the future the timer should first fire.
+  * @param period_ns 0 for a one-shot timer, or the interval at which the timer should repeat.
+  * @return A timer ID that can be passed to watch_host_clear_timer, or -1 if all timers are in use.
+  */
+int8_t watch_host_set_timer(watch_host_timer_cb callback, void *user_data, uint64_t delay_ns, uint64_t period_ns);
+
+/** @brief Arms a timer that models a peripheral running on its own (i.e. the SLCD's blink and tick
+  *        animations, or a finger on a button). It does not wake the core when it fires; if its callback
+  *        ends up calling into the firmware, it should call watch_host_raise_interrupt.
+  * @details Parameters and return value are the same as for watch_host_set_timer.
+  */
+int8_t watch_host_set_peripheral_timer(watch_host_timer_cb callback, void *user_data, uint64_t delay_ns, uint64_t period_ns);
+
+/** @brief Marks that an interrupt was serviced, so that watch_host_wait_for_interrupt returns.
+  */
+void watch_host_raise_interrupt(void);
+
+/** @brief Disarms a timer. Passing -1 is a no-op, so you can call this on a timer you never armed.
+  */
+void watch_host_clear_timer(int8_t timer_id);
+
+/** @brief Moves the virtual clock forward, firing any timers that come due along the way.
+  * @details This is the host equivalent of a busy-wait: delay_ms and friends end up here.
+  */
+void watch_host_advance(uint64_t duration_ns);
+
+/** @brief Moves the virtual clock forward until an interrupt fires, firing peripheral timers along the way.
+  * @param state The power state we are waiting in; only used for bookkeeping.
+  * @note If the end of the run is reached first, this function does not return; it calls exit().
+  */
+void watch_host_wait_for_interrupt(watch_host_power_state_t state);
+
+/** @brief Returns the power state the host is currently waiting in, or WATCH_HOST_POWER_ACTIVE.
+  */
+watch_host_power_state_t watch_host_get_power_state(void);
+
+/** @brief Sets the virtual time at which the run ends.
+  */
+void watch_host_set_end_time(uint64_t time_ns);
+
+/** @brief Returns a pointer to the run's counters.
+  */
+watch_host_stats_t *watch_host_get_stats(void);
+
+/// @brief A device on the host's I2C bus, standing in for one of the watch's sensors.
+typedef struct {
+    uint8_t address;                                                    // its 7-bit address
+    void (*write)(void *context, const uint8_t *buf, uint16_t length);  // called for every send to the device
+    void (*read)(void *context, uint8_t *buf, uint16_t length);         // called for every receive from it
+    void *context;                                                      // passed through to write and read
+} watch_host_i2c_device_t;
+
+/** @brief Attaches a device to the host's I2C bus. Receives from an address with no device read back zeroes.
+  * @param device The device; it is copied, so it doesn't need to stay around.
+  */
+void watch_host_attach_i2c_device(const watch_host_i2c_device_t *device);
+
+/** @brief Returns how many times a row of the emulated RWW EEPROM has been erased, for looking at wear.
+  */
+uint32_t watch_host_get_storage_row_erases(uint32_t row);
+
+/** @brief Returns the contents of the emulated RWW EEPROM, i.e. to save or load a filesystem image.
+  * @param size If not NULL, receives the size of the EEPROM in bytes.
+  */
+uint8_t *watch_host_get_storage(uint32_t *size);
+
+/** @brief Returns the contents of the emulated SPI flash, which is erased (all 0xFF) to start with.
+  * @param size If not NULL, receives the size of the flash in bytes.
+  */
+uint8_t *watch_host_get_spi_flash(uint32_t *size);
+
+/// @brief Called by watch_set_pin_level when the SPI flash's chip select (A3) changes; true when it goes low.
+void _watch_host_spi_flash_select(bool selected);
+
+/** @brief Tells the energy model that a load has been switched on, off, or to a different duty cycle.
+  * @param load The load that changed.
+  * @param duty How much of the time it is on, from 0 (off) to 255 (always on).
+  */
+void watch_host_set_load(watch_host_load_t load, uint8_t duty);
+
+/** @brief Returns a pointer to the energy model, in case you want to try different figures.
+  */
+watch_host_energy_model_t *watch_host_get_energy_model(void);
+
+/** @brief Returns the average current drawn so far, in µA, according to the energy model.
+  * @param breakdown If not NULL, an array of WATCH_HOST_NUM_POWER_STATES + WATCH_HOST_NUM_LOADS + 2 values that
+  *                  receives each thing's share of that average: the power states, the loads, wakeups and
+  *                  then LCD segment toggles.
+  */
+double watch_host_get_average_current(double *breakdown);
+
+/** @brief Changes the level of an input pin and fires any interrupt registered on it, just like a button press.
+  * @details While the host is in sleep mode, only the pin registered with watch_register_extwake_callback
+  *          can wake the watch, same as on hardware.
+  */
+void watch_host_set_pin_level(uint8_t pin, bool level);
+
+/** @brief Renders the segment LCD framebuffer as text.
+  * @param buf A buffer of at least 40 bytes. On return it contains the ten character positions, followed by
+  *            the names of any indicators that are lit.
+  */
+void watch_host_get_display(char *buf);
+
+/** @brief Returns true if the display changed since the last call to this function.
+  */
+bool watch_host_display_changed(void);
+
+/// @brief Registers the extwake callback for the watch_deepsleep implementation. Internal use only.
+void _watch_host_register_extwake_callback(uint8_t pin, void (*callback)(void), bool level);
+
+/// @}
+#endif
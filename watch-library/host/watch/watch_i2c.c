@@ -0,0 +1,123 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2020 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+#include "watch_i2c.h"
+#include "watch_host.h"
+
+#define MAX_I2C_DEVICES 4
+
+// The bus is a list of devices that tests attach; anything addressed to nobody reads back as zeroes. Every
+// transaction is counted, and moves the clock forward by as long as it would take on the wire at 100 kHz:
+// a start, the address byte, the data bytes, each with its ack, and a stop.
+static watch_host_i2c_device_t _devices[MAX_I2C_DEVICES];
+static uint8_t _num_devices = 0;
+
+void watch_host_attach_i2c_device(const watch_host_i2c_device_t *device) {
+    if (_num_devices < MAX_I2C_DEVICES) _devices[_num_devices++] = *device;
+}
+
+static watch_host_i2c_device_t *_find_device(int16_t addr) {
+    for (uint8_t i = 0; i < _num_devices; i++) {
+        if (_devices[i].address == addr) return &_devices[i];
+    }
+
+    return NULL;
+}
+
+static void _bus_transaction(uint16_t length) {
+    watch_host_stats_t *stats = watch_host_get_stats();
+    uint64_t duration_ns = (2 + 9 * (1 + (uint64_t)length)) * WATCH_HOST_I2C_NS_PER_BIT;
+
+    stats->i2c_transactions++;
+    stats->i2c_bytes += length;
+    stats->i2c_busy_ns += duration_ns;
+    watch_host_advance(duration_ns);
+}
+
+void watch_enable_i2c(void) {
+    watch_host_set_load(WATCH_HOST_LOAD_I2C, 255);
+}
+
+void watch_disable_i2c(void) {
+    watch_host_set_load(WATCH_HOST_LOAD_I2C, 0);
+}
+
+void watch_i2c_send(int16_t addr, uint8_t *buf, uint16_t length) {
+    watch_host_i2c_device_t *device = _find_device(addr);
+    if (device && device->write) device->write(device->context, buf, length);
+    _bus_transaction(length);
+}
+
+void watch_i2c_receive(int16_t addr, uint8_t *buf, uint16_t length) {
+    watch_host_i2c_device_t *device = _find_device(addr);
+    if (device && device->read) device->read(device->context, buf, length);
+    else memset(buf, 0, length);
+    _bus_transaction(length);
+}
+
+void watch_i2c_write8(int16_t addr, uint8_t reg, uint8_t data) {
+    uint8_t buf[2];
+    buf[0] = reg;
+    buf[1] = data;
+
+    watch_i2c_send(addr, (uint8_t *)&buf, 2);
+}
+
+uint8_t watch_i2c_read8(int16_t addr, uint8_t reg) {
+    uint8_t data;
+
+    watch_i2c_send(addr, (uint8_t *)&reg, 1);
+    watch_i2c_receive(addr, (uint8_t *)&data, 1);
+
+    return data;
+}
+
+uint16_t watch_i2c_read16(int16_t addr, uint8_t reg) {
+    uint16_t data;
+
+    watch_i2c_send(addr, (uint8_t *)&reg, 1);
+    watch_i2c_receive(addr, (uint8_t *)&data, 2);
+
+    return data;
+}
+
+uint32_t watch_i2c_read24(int16_t addr, uint8_t reg) {
+    uint32_t data;
+    data = 0;
+
+    watch_i2c_send(addr, (uint8_t *)&reg, 1);
+    watch_i2c_receive(addr, (uint8_t *)&data, 3);
+
+    return data << 8;
+}
+
+uint32_t watch_i2c_read32(int16_t addr, uint8_t reg) {
+    uint32_t data;
+
+    watch_i2c_send(addr, (uint8_t *)&reg, 1);
+    watch_i2c_receive(addr, (uint8_t *)&data, 4);
+
+    return data;
+}
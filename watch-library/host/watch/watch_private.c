@@ -0,0 +1,62 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 The Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "watch_private.h"
+#include "watch_host.h"
+
+void _watch_init(void) {
+    // External wake depends on RTC; calendar is a required module.
+    _watch_rtc_init();
+}
+
+// TCC0 drives both the buzzer and the LEDs, so like the hardware, we track one enable for the two of them.
+static bool _tcc_enabled;
+
+void _watch_enable_tcc(void) {
+    _tcc_enabled = true;
+}
+
+void _watch_disable_tcc(void) {
+    // this also turns off the PWM pins, so nothing the TCC drives keeps drawing current.
+    watch_set_buzzer_off();
+    watch_set_led_off();
+    _tcc_enabled = false;
+}
+
+bool watch_is_buzzer_or_led_enabled(void) {
+    return _tcc_enabled;
+}
+
+void _watch_enable_usb(void) {}
+
+void watch_disable_TRNG(void) {}
+
+void delay_ms(const uint16_t ms) {
+    watch_host_advance(ms * WATCH_HOST_NSEC_PER_MSEC);
+}
+
+void delay_us(const uint16_t us) {
+    watch_host_advance(us * (WATCH_HOST_NSEC_PER_MSEC / 1000));
+}
@@ -0,0 +1,240 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 The Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include "watch_rtc.h"
+#include "watch_utility.h"
+#include "watch_host.h"
+
+// unix timestamp of the moment the virtual clock started
+static uint32_t _rtc_epoch;
+static int8_t _periodic_timers[8] = { -1, -1, -1, -1, -1, -1, -1, -1 };
+
+// like the hardware, we count 128 Hz periodic interrupts for the ticks and the timeout, so that a pending
+// timeout wakes the core (and costs energy) just as often here as it does on the watch.
+static volatile uint32_t _tick_count;
+static uint16_t _timeout_remaining;
+static ext_irq_cb_t _timeout_callback;
+static ext_irq_cb_t _tick_128hz_callback;
+
+static int8_t _alarm_timer = -1;
+static watch_date_time _alarm_time;
+static watch_rtc_alarm_match _alarm_mask;
+static ext_irq_cb_t _alarm_callback;
+
+static inline uint32_t _watch_rtc_get_timestamp(void) {
+    return _rtc_epoch + (uint32_t)(watch_host_get_time_ns() / WATCH_HOST_NSEC_PER_SEC);
+}
+
+bool _watch_rtc_is_enabled(void) {
+    return true;
+}
+
+void _watch_rtc_init(void) {
+}
+
+static void _watch_rtc_schedule_alarm(void);
+
+void watch_rtc_set_date_time(watch_date_time date_time) {
+    _rtc_epoch = watch_utility_date_time_to_unix_time(date_time, 0) - (uint32_t)(watch_host_get_time_ns() / WATCH_HOST_NSEC_PER_SEC);
+    if (_alarm_callback) _watch_rtc_schedule_alarm();
+}
+
+watch_date_time watch_rtc_get_date_time(void) {
+    return watch_utility_date_time_from_unix_time(_watch_rtc_get_timestamp(), 0);
+}
+
+void watch_rtc_register_tick_callback(ext_irq_cb_t callback) {
+    watch_rtc_register_periodic_callback(callback, 1);
+}
+
+void watch_rtc_disable_tick_callback(void) {
+    watch_rtc_disable_periodic_callback(1);
+}
+
+static void _watch_invoke_periodic_callback(void *user_data) {
+    ext_irq_cb_t callback = (ext_irq_cb_t)user_data;
+    callback();
+}
+
+static void _watch_rtc_handle_128hz_tick(void *user_data);
+
+// PER0 runs whenever a timeout is pending or someone asked for 128 Hz callbacks, and stops when neither is true.
+static void _watch_rtc_update_128hz_timer(void) {
+    bool needed = _timeout_callback != NULL || _tick_128hz_callback != NULL;
+
+    if (needed && _periodic_timers[0] == -1) {
+        uint64_t period = WATCH_HOST_NSEC_PER_SEC / 128;
+        uint64_t delay = period - (watch_host_get_time_ns() % period);
+        _periodic_timers[0] = watch_host_set_timer(_watch_rtc_handle_128hz_tick, NULL, delay, period);
+    } else if (!needed && _periodic_timers[0] != -1) {
+        watch_host_clear_timer(_periodic_timers[0]);
+        _periodic_timers[0] = -1;
+    }
+}
+
+void watch_rtc_register_periodic_callback(ext_irq_cb_t callback, uint8_t frequency) {
+    // we told them, it has to be a power of 2.
+    if (__builtin_popcount(frequency) != 1) return;
+
+    // this left-justifies the period in a 32-bit integer.
+    uint32_t tmp = (frequency & 0xFF) << 24;
+    // now we can count the leading zeroes to get the value we need.
+    // 0x01 (1 Hz) will have 7 leading zeros for PER7. 0xF0 (128 Hz) will have no leading zeroes for PER0.
+    uint8_t per_n = __builtin_clz(tmp);
+
+    if (per_n == 0) {
+        _tick_128hz_callback = callback;
+        _watch_rtc_update_128hz_timer();
+        return;
+    }
+
+    // periodic interrupts come from the RTC prescaler, so they stay aligned to the top of the second.
+    uint64_t period = WATCH_HOST_NSEC_PER_SEC / frequency;
+    uint64_t delay = period - (watch_host_get_time_ns() % period);
+
+    watch_host_clear_timer(_periodic_timers[per_n]);
+    _periodic_timers[per_n] = watch_host_set_timer(_watch_invoke_periodic_callback, (void *)callback, delay, period);
+}
+
+void watch_rtc_disable_periodic_callback(uint8_t frequency) {
+    if (__builtin_popcount(frequency) != 1) return;
+    uint8_t per_n = __builtin_clz((frequency & 0xFF) << 24);
+    watch_rtc_disable_matching_periodic_callbacks(1 << per_n);
+}
+
+void watch_rtc_disable_matching_periodic_callbacks(uint8_t mask) {
+    if (mask & 1) {
+        // a pending timeout still needs the 128 Hz interrupt, so leave it running; the callback just won't be called.
+        _tick_128hz_callback = NULL;
+        _watch_rtc_update_128hz_timer();
+    }
+    for (int i = 1; i < 8; i++) {
+        if (mask & (1 << i)) {
+            watch_host_clear_timer(_periodic_timers[i]);
+            _periodic_timers[i] = -1;
+        }
+    }
+}
+
+void watch_rtc_disable_all_periodic_callbacks(void) {
+    watch_rtc_disable_matching_periodic_callbacks(0xFF);
+}
+
+uint32_t watch_rtc_get_ticks(void) {
+    return _tick_count;
+}
+
+void watch_rtc_register_timeout_callback(ext_irq_cb_t callback, uint16_t ticks) {
+    _timeout_remaining = ticks ? ticks : 1;
+    _timeout_callback = callback;
+    _watch_rtc_update_128hz_timer();
+}
+
+void watch_rtc_disable_timeout_callback(void) {
+    _timeout_callback = NULL;
+    _watch_rtc_update_128hz_timer();
+}
+
+static void _watch_rtc_handle_128hz_tick(void *user_data) {
+    (void) user_data;
+    _tick_count++;
+    if (_timeout_callback != NULL && --_timeout_remaining == 0) {
+        ext_irq_cb_t callback = _timeout_callback;
+        // clear it before calling out, so the callback can register the next timeout.
+        watch_rtc_disable_timeout_callback();
+        callback();
+    }
+    if (_tick_128hz_callback != NULL) _tick_128hz_callback();
+}
+
+static void _watch_invoke_alarm_callback(void *user_data) {
+    (void) user_data;
+    _alarm_timer = -1;
+    // re-arm for the next match before calling out, in case the callback changes the alarm.
+    _watch_rtc_schedule_alarm();
+    if (_alarm_callback) _alarm_callback();
+}
+
+static void _watch_rtc_schedule_alarm(void) {
+    uint32_t now = _watch_rtc_get_timestamp();
+    watch_date_time date_time = watch_utility_date_time_from_unix_time(now, 0);
+    uint32_t elapsed, target, cycle;
+
+    switch (_alarm_mask) {
+        case ALARM_MATCH_SS:
+            elapsed = date_time.unit.second;
+            target = _alarm_time.unit.second;
+            cycle = 60;
+            break;
+        case ALARM_MATCH_MMSS:
+            elapsed = date_time.unit.minute * 60 + date_time.unit.second;
+            target = _alarm_time.unit.minute * 60 + _alarm_time.unit.second;
+            cycle = 60 * 60;
+            break;
+        case ALARM_MATCH_HHMMSS:
+            elapsed = date_time.unit.hour * 3600 + date_time.unit.minute * 60 + date_time.unit.second;
+            target = _alarm_time.unit.hour * 3600 + _alarm_time.unit.minute * 60 + _alarm_time.unit.second;
+            cycle = 24 * 60 * 60;
+            break;
+        default:
+            return;
+    }
+
+    // the match happens at the start of the matching second, but the interrupt fires at the next rising
+    // edge of CLK_RTC_CNT, i.e. one second later. this is why Movement asks for :59 to update at :00.
+    uint64_t second_start = (uint64_t)(now - _rtc_epoch) * WATCH_HOST_NSEC_PER_SEC;
+    uint64_t fire_at = second_start + (uint64_t)((target + cycle - elapsed) % cycle + 1) * WATCH_HOST_NSEC_PER_SEC;
+
+    watch_host_clear_timer(_alarm_timer);
+    _alarm_timer = watch_host_set_timer(_watch_invoke_alarm_callback, NULL, fire_at - watch_host_get_time_ns(), 0);
+}
+
+void watch_rtc_register_alarm_callback(ext_irq_cb_t callback, watch_date_time alarm_time, watch_rtc_alarm_match mask) {
+    watch_rtc_disable_alarm_callback();
+    if (mask == ALARM_MATCH_DISABLED) return;
+
+    _alarm_callback = callback;
+    _alarm_time = alarm_time;
+    _alarm_mask = mask;
+    _watch_rtc_schedule_alarm();
+}
+
+void watch_rtc_disable_alarm_callback(void) {
+    watch_host_clear_timer(_alarm_timer);
+    _alarm_timer = -1;
+    _alarm_callback = NULL;
+    _alarm_mask = ALARM_MATCH_DISABLED;
+}
+
+void watch_rtc_enable(bool en) {
+    // Not simulated
+    (void) en;
+}
+
+void watch_rtc_freqcorr_write(int16_t value, int16_t sign) {
+    // Not simulated
+    (void) value;
+    (void) sign;
+}
@@ -0,0 +1,168 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 The Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+
+#include <string.h>
+#include "watch_slcd.h"
+#include "watch_private_display.h"
+#include "watch_host.h"
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Segmented Display
+
+// one word per COM line; bit n is SEG n. this stands in for the SLCD's data registers.
+static uint32_t _slcd_framebuffer[3];
+static bool _slcd_changed;
+
+static char blink_character;
+static bool blink_state;
+static int8_t blink_timer_id = -1;
+static bool tick_state;
+static int8_t tick_timer_id = -1;
+
+void watch_enable_display(void) {
+    watch_clear_display();
+}
+
+void _watch_display_write_segments(void) {
+    watch_host_stats_t *stats = watch_host_get_stats();
+
+    for (uint8_t com = 0; com < 3; com++) {
+        uint32_t changed = Segment_Data[com] ^ _slcd_framebuffer[com];
+        if (!changed) continue;
+        _slcd_framebuffer[com] = Segment_Data[com];
+        _slcd_changed = true;
+        stats->segment_toggles += __builtin_popcount(changed);
+        stats->slcd_register_writes++;
+    }
+}
+
+static void watch_invoke_blink_callback(void *user_data) {
+    (void) user_data;
+    blink_state = !blink_state;
+    watch_display_character(blink_state ? blink_character : ' ', 7);
+    watch_clear_pixel(2, 10); // clear segment B of position 7 since it can't blink
+    watch_display_commit();
+}
+
+void watch_start_character_blink(char character, uint32_t duration) {
+    if (blink_timer_id != -1) return;
+    watch_display_character(character, 7);
+    watch_clear_pixel(2, 10); // clear segment B of position 7 since it can't blink
+
+    blink_state = true;
+    blink_character = character;
+    blink_timer_id = watch_host_set_peripheral_timer(watch_invoke_blink_callback, NULL, duration * WATCH_HOST_NSEC_PER_MSEC, duration * WATCH_HOST_NSEC_PER_MSEC);
+}
+
+void watch_stop_blink(void) {
+    watch_host_clear_timer(blink_timer_id);
+    blink_timer_id = -1;
+    blink_state = false;
+}
+
+static void watch_invoke_tick_callback(void *user_data) {
+    (void) user_data;
+    tick_state = !tick_state;
+    if (tick_state) {
+        watch_clear_pixel(0, 2);
+        watch_set_pixel(0, 3);
+    } else {
+        watch_clear_pixel(0, 3);
+        watch_set_pixel(0, 2);
+    }
+    watch_display_commit();
+}
+
+void watch_start_tick_animation(uint32_t duration) {
+    if (tick_timer_id != -1) return;
+    watch_display_character(' ', 8);
+
+    tick_state = true;
+    tick_timer_id = watch_host_set_peripheral_timer(watch_invoke_tick_callback, NULL, duration * WATCH_HOST_NSEC_PER_MSEC, duration * WATCH_HOST_NSEC_PER_MSEC);
+}
+
+bool watch_tick_animation_is_running(void) {
+    return tick_timer_id != -1;
+}
+
+void watch_stop_tick_animation(void) {
+    watch_host_clear_timer(tick_timer_id);
+    tick_timer_id = -1;
+    tick_state = false;
+
+    watch_display_character(' ', 8);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////
+// Reading the framebuffer back
+
+static inline bool _watch_host_get_pixel(uint8_t com, uint8_t seg) {
+    return (_slcd_framebuffer[com] >> seg) & 1;
+}
+
+// Characters that share a segment pattern render identically; when reading the display back we prefer
+// digits, then capitals, then everything else, which is what most faces put on screen.
+static const char _watch_host_decode_order[] =
+    " 0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz-_=+'\"/\\()[]<>?^`~,.!#$&*{|}@";
+
+static char _watch_host_decode_position(uint8_t position) {
+    uint64_t segmap = Segment_Map[position];
+    uint8_t segdata = 0;
+    uint8_t mask = 0;
+
+    for (int i = 0; i < 8; i++) {
+        uint8_t com = (segmap & 0xFF) >> 6;
+        if (com <= 2) {
+            mask |= 1 << i;
+            if (_watch_host_get_pixel(com, segmap & 0x3F)) segdata |= 1 << i;
+        }
+        segmap = segmap >> 8;
+    }
+
+    for (size_t i = 0; i < sizeof(_watch_host_decode_order) - 1; i++) {
+        char c = _watch_host_decode_order[i];
+        if ((Character_Set[c - 0x20] & mask) == segdata) return c;
+    }
+
+    return '?';
+}
+
+void watch_host_get_display(char *buf) {
+    for (uint8_t i = 0; i < Num_Chars; i++) buf[i] = _watch_host_decode_position(i);
+    buf[Num_Chars] = 0;
+
+    if (_watch_host_get_pixel(1, 16)) strcat(buf, " :");
+    if (_watch_host_get_pixel(2, 17)) strcat(buf, " PM");
+    if (_watch_host_get_pixel(2, 16)) strcat(buf, " 24H");
+    if (_watch_host_get_pixel(0, 16)) strcat(buf, " BELL");
+    if (_watch_host_get_pixel(0, 17)) strcat(buf, " SIG");
+    if (_watch_host_get_pixel(1, 10)) strcat(buf, " LAP");
+}
+
+bool watch_host_display_changed(void) {
+    bool changed = _slcd_changed;
+    _slcd_changed = false;
+    return changed;
+}
@@ -0,0 +1,190 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2022 Joey Castillo
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+#include "watch_spi.h"
+#include "watch_host.h"
+#include "spiflash.h"
+
+#define FLASH_PAGE_SIZE 256
+#define FLASH_SECTOR_SIZE 4096
+
+// The SPI bus has one device on it: the NOR flash on the sensor boards, selected by pulling A3 low. It speaks
+// the usual Winbond command set: reads and fast reads, page programs that can only clear bits and wrap around
+// within their page, 4 KB sector and chip erases, and a write enable latch that each program or erase uses up.
+// Programs and erases start when chip select goes high, and keep the chip busy for the datasheet's typical
+// time; it ignores everything but READ_STATUS until then. Every call into the SPI driver moves the clock
+// forward by the time it would take at 1 MHz, plus the driver's own overhead.
+static uint8_t _flash[WATCH_HOST_SPI_FLASH_SIZE];
+static bool _flash_initialized = false;
+
+static bool _selected = false;
+static uint32_t _position;      // bytes clocked in since chip select went low
+static uint8_t _command;
+static uint32_t _address;
+static bool _ignoring;          // the chip was busy when the command came in
+static bool _write_enabled = false;
+static uint64_t _busy_until = 0;
+static uint8_t _page_buffer[FLASH_PAGE_SIZE];
+
+static void _initialize_flash(void) {
+    if (_flash_initialized) return;
+    memset(_flash, 0xFF, sizeof(_flash));
+    _flash_initialized = true;
+}
+
+static bool _flash_busy(void) {
+    return watch_host_get_time_ns() < _busy_until;
+}
+
+static void _run_command(void) {
+    watch_host_stats_t *stats = watch_host_get_stats();
+
+    if (_ignoring || _position < 4 || !_write_enabled) return;
+    switch (_command) {
+        case CMD_PAGE_PROGRAM:
+        {
+            uint8_t *page = _flash + (_address & ~(FLASH_PAGE_SIZE - 1));
+            for (uint16_t i = 0; i < FLASH_PAGE_SIZE; i++) page[i] &= _page_buffer[i];
+            _busy_until = watch_host_get_time_ns() + WATCH_HOST_SPI_FLASH_PAGE_PROGRAM_NS;
+            stats->spi_flash_page_programs++;
+            break;
+        }
+        case CMD_SECTOR_ERASE:
+            memset(_flash + (_address & ~(FLASH_SECTOR_SIZE - 1)), 0xFF, FLASH_SECTOR_SIZE);
+            _busy_until = watch_host_get_time_ns() + WATCH_HOST_SPI_FLASH_SECTOR_ERASE_NS;
+            stats->spi_flash_sector_erases++;
+            break;
+        default:
+            return;
+    }
+    _write_enabled = false;
+}
+
+void _watch_host_spi_flash_select(bool selected) {
+    if (selected == _selected) return;
+    _selected = selected;
+    if (selected) {
+        _initialize_flash();
+        _position = 0;
+        watch_host_get_stats()->spi_flash_commands++;
+        return;
+    }
+
+    // chip select going high is what starts a program or erase.
+    if (_position && _command == CMD_CHIP_ERASE && !_ignoring && _write_enabled) {
+        memset(_flash, 0xFF, sizeof(_flash));
+        _busy_until = watch_host_get_time_ns() + WATCH_HOST_SPI_FLASH_CHIP_ERASE_NS;
+        _write_enabled = false;
+    } else {
+        _run_command();
+    }
+}
+
+static uint8_t _clock_byte(uint8_t out) {
+    if (!_selected) return 0xFF;
+
+    uint32_t position = _position++;
+    if (position == 0) {
+        _command = out;
+        _address = 0;
+        _ignoring = _flash_busy() && _command != CMD_READ_STATUS;
+        if (_ignoring) return 0xFF;
+        if (_command == CMD_ENABLE_WRITE) _write_enabled = true;
+        if (_command == CMD_DISABLE_WRITE) _write_enabled = false;
+        if (_command == CMD_PAGE_PROGRAM) memset(_page_buffer, 0xFF, sizeof(_page_buffer));
+        return 0xFF;
+    }
+    if (_ignoring) return 0xFF;
+
+    switch (_command) {
+        case CMD_READ_STATUS:
+            return (_flash_busy() ? SPI_FLASH_STATUS_BUSY : 0) | (_write_enabled ? SPI_FLASH_STATUS_WEL : 0);
+        case CMD_READ_JEDEC_ID:
+        {
+            // a Winbond W25Q16
+            static const uint8_t jedec_id[] = { 0xEF, 0x40, 0x15 };
+            return jedec_id[(position - 1) % 3];
+        }
+        case CMD_READ_DATA:
+        case CMD_FAST_READ_DATA:
+        case CMD_PAGE_PROGRAM:
+        case CMD_SECTOR_ERASE:
+            if (position <= 3) {
+                _address = ((_address << 8) | out) & (WATCH_HOST_SPI_FLASH_SIZE - 1);
+                return 0xFF;
+            }
+            if (_command == CMD_READ_DATA) return _flash[_address++ & (WATCH_HOST_SPI_FLASH_SIZE - 1)];
+            if (_command == CMD_FAST_READ_DATA) {
+                if (position == 4) return 0xFF; // the dummy byte
+                return _flash[_address++ & (WATCH_HOST_SPI_FLASH_SIZE - 1)];
+            }
+            if (_command == CMD_PAGE_PROGRAM) _page_buffer[(_address + position - 4) % FLASH_PAGE_SIZE] = out;
+            return 0xFF;
+        default:
+            return 0xFF;
+    }
+}
+
+static void _spi_call(uint16_t length) {
+    watch_host_stats_t *stats = watch_host_get_stats();
+    uint64_t duration_ns = WATCH_HOST_SPI_CALL_NS + length * WATCH_HOST_SPI_NS_PER_BYTE;
+
+    stats->spi_calls++;
+    stats->spi_bytes += length;
+    stats->spi_busy_ns += duration_ns;
+    watch_host_advance(duration_ns);
+}
+
+void watch_enable_spi(void) {
+    watch_host_set_load(WATCH_HOST_LOAD_SPI, 255);
+}
+
+void watch_disable_spi(void) {
+    watch_host_set_load(WATCH_HOST_LOAD_SPI, 0);
+}
+
+bool watch_spi_write(const uint8_t *buf, uint16_t length) {
+    for (uint16_t i = 0; i < length; i++) _clock_byte(buf[i]);
+    _spi_call(length);
+    return true;
+}
+
+bool watch_spi_read(uint8_t *buf, uint16_t length) {
+    for (uint16_t i = 0; i < length; i++) buf[i] = _clock_byte(0xFF);
+    _spi_call(length);
+    return true;
+}
+
+bool watch_spi_transfer(const uint8_t *data_out, uint8_t *data_in, uint16_t length) {
+    for (uint16_t i = 0; i < length; i++) data_in[i] = _clock_byte(data_out[i]);
+    _spi_call(length);
+    return true;
+}
+
+uint8_t *watch_host_get_spi_flash(uint32_t *size) {
+    _initialize_flash();
+    if (size) *size = WATCH_HOST_SPI_FLASH_SIZE;
+    return _flash;
+}
@@ -0,0 +1,81 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include "watch_storage.h"
+#include "watch_host.h"
+
+#define STORAGE_NUM_ROWS (NVMCTRL_RWWEE_PAGES / (NVMCTRL_ROW_SIZE / NVMCTRL_PAGE_SIZE))
+
+// The RWW EEPROM, as the NVM controller presents it: reads go through the bus a halfword at a time, while page
+// writes and row erases are commands that run on their own until the next access waits for them to finish.
+// Like real flash, a page write can only clear bits; only an erase sets them again.
+uint8_t storage[NVMCTRL_ROW_SIZE * STORAGE_NUM_ROWS];
+
+static uint32_t _row_erases[STORAGE_NUM_ROWS];
+static uint64_t _busy_until = 0;
+
+static void _storage_busy(uint64_t duration_ns) {
+    watch_host_get_stats()->storage_busy_ns += duration_ns;
+    watch_host_advance(duration_ns);
+}
+
+static bool _is_valid_range(uint32_t row, uint32_t offset, uint32_t size) {
+    return row < STORAGE_NUM_ROWS && offset + size <= NVMCTRL_ROW_SIZE;
+}
+
+bool watch_storage_read(uint32_t row, uint32_t offset, uint8_t *buffer, uint32_t size) {
+    if (!_is_valid_range(row, offset, size)) return false;
+    watch_storage_sync();
+
+    watch_host_stats_t *stats = watch_host_get_stats();
+    stats->storage_reads++;
+    stats->storage_bytes_read += size;
+    _storage_busy((size + (offset & 1) + 1) / 2 * WATCH_HOST_STORAGE_READ_NS);
+    memcpy(buffer, storage + row * NVMCTRL_ROW_SIZE + offset, size);
+
+    return true;
+}
+
+bool watch_storage_write(uint32_t row, uint32_t offset, const uint8_t *buffer, uint32_t size) {
+    if (!_is_valid_range(row, offset, size)) return false;
+    // the page buffer only holds one page, so a write can't cross into the next.
+    if (offset / NVMCTRL_PAGE_SIZE != (offset + size - 1) / NVMCTRL_PAGE_SIZE) return false;
+    watch_storage_sync();
+
+    uint8_t *page = storage + row * NVMCTRL_ROW_SIZE + offset;
+    for (uint32_t i = 0; i < size; i++) page[i] &= buffer[i];
+
+    watch_host_get_stats()->storage_page_writes++;
+    _busy_until = watch_host_get_time_ns() + WATCH_HOST_STORAGE_PAGE_WRITE_NS;
+
+    return true;
+}
+
+bool watch_storage_erase(uint32_t row) {
+    if (!_is_valid_range(row, 0, NVMCTRL_ROW_SIZE)) return false;
+    watch_storage_sync();
+
+    memset(storage + row * NVMCTRL_ROW_SIZE, 0xff, NVMCTRL_ROW_SIZE);
+
+    _row_erases[row]++;
+    watch_host_get_stats()->storage_row_erases++;
+    _busy_until = watch_host_get_time_ns() + WATCH_HOST_STORAGE_ROW_ERASE_NS;
+
+    return true;
+}
+
+bool watch_storage_sync(void) {
+    uint64_t now = watch_host_get_time_ns();
+    if (_busy_until > now) _storage_busy(_busy_until - now);
+
+    return true;
+}
+
+uint32_t watch_host_get_storage_row_erases(uint32_t row) {
+    return row < STORAGE_NUM_ROWS ? _row_erases[row] : 0;
+}
+
+uint8_t *watch_host_get_storage(uint32_t *size) {
+    if (size) *size = sizeof(storage);
+    return storage;
+}
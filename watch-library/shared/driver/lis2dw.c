@@ -194,10 +194,28 @@ bool lis2dw_read_fifo(lis2dw_fifo_t *fifo_data) {
     uint8_t temp = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_FIFO_SAMPLE);
     bool overrun = !!(temp & LIS2DW_FIFO_SAMPLE_OVERRUN);
 
-    fifo_data->count = temp & LIS2DW_FIFO_SAMPLE_COUNT;
+    uint8_t count = temp & LIS2DW_FIFO_SAMPLE_COUNT;
+    if (count > 32) count = 32; // the FIFO holds 32 samples; the count field reads 32 at most.
+    fifo_data->count = count;
+    if (!count) return overrun;
+
+    // With the FIFO on, reading past OUT_Z_H rolls the address back to OUT_X_L and pops the next sample, so
+    // the whole FIFO comes out in one transaction, six bytes per sample. It lands right in readings, which
+    // are six bytes each too; then we put each one together from its bytes, whatever the CPU's byte order.
+    _Static_assert(sizeof(lis2dw_reading_t) == 6, "lis2dw_reading_t must be three packed int16_t");
+    uint8_t reg = LIS2DW_REG_OUT_X_L | 0x80; // set high bit for consecutive reads
+    uint8_t *bytes = (uint8_t *)fifo_data->readings;
 
-    for(int i = 0; i < fifo_data->count; i++) {
-        fifo_data->readings[i] = lis2dw_get_raw_reading();
+    watch_i2c_send(LIS2DW_ADDRESS, &reg, 1);
+    watch_i2c_receive(LIS2DW_ADDRESS, bytes, count * 6);
+
+    for(uint8_t i = 0; i < count; i++) {
+        uint8_t *buffer = bytes + i * 6;
+        lis2dw_reading_t reading;
+        reading.x = buffer[0] | ((uint16_t)buffer[1]) << 8;
+        reading.y = buffer[2] | ((uint16_t)buffer[3]) << 8;
+        reading.z = buffer[4] | ((uint16_t)buffer[5]) << 8;
+        fifo_data->readings[i] = reading;
     }
 
     return overrun;
@@ -229,6 +247,21 @@ void lis2dw_configure_wakeup_int1(uint8_t threshold, bool latch, bool active_sta
     watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL7, configuration | LIS2DW_CTRL7_VAL_INTERRUPTS_ENABLE);
 }
 
+void lis2dw_configure_fifo_threshold_int1(uint8_t threshold) {
+    uint8_t configuration;
+
+    // collect samples continuously, and set the FIFO threshold
+    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_FIFO_CTRL, LIS2DW_FIFO_CTRL_MODE_COLLECT_CONTINUOUS | (threshold & LIS2DW_FIFO_CTRL_FTH));
+
+    // INT1 goes high when the FIFO holds at least that many samples, and low again once it's been read below that.
+    configuration = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL4_INT1);
+    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL4_INT1, configuration | LIS2DW_CTRL4_INT1_FTH);
+
+    // enable interrupts
+    configuration = watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL7);
+    watch_i2c_write8(LIS2DW_ADDRESS, LIS2DW_REG_CTRL7, configuration | LIS2DW_CTRL7_VAL_INTERRUPTS_ENABLE);
+}
+
 lis2dw_wakeup_source lis2dw_get_wakeup_source() {
     return (lis2dw_wakeup_source) watch_i2c_read8(LIS2DW_ADDRESS, LIS2DW_REG_WAKE_UP_SRC);
 }
@@ -337,6 +337,13 @@ void lis2dw_clear_fifo(void);
 
 void lis2dw_configure_wakeup_int1(uint8_t threshold, bool latch, bool active_state);
 
+/** @brief Puts the FIFO in continuous mode, and raises INT1 whenever it holds at least threshold samples.
+  * @details INT1 stays high until lis2dw_read_fifo has drained the FIFO below the threshold, so read the whole
+  *          FIFO each time, or you won't see another rising edge.
+  * @param threshold The number of samples, from 1 to 31.
+  */
+void lis2dw_configure_fifo_threshold_int1(uint8_t threshold);
+
 lis2dw_interrupt_source lis2dw_get_interrupt_source(void);
 
 lis2dw_wakeup_source lis2dw_get_wakeup_source(void);
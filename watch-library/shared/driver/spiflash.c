@@ -39,6 +39,7 @@ static void flash_disable(void) {
 }
 
 static bool transfer(uint8_t *command, uint32_t command_length, uint8_t *data_in, uint8_t *data_out, uint32_t data_length) {
+    flash_enable();
     bool status = watch_spi_write(command, command_length);
     if (status) {
         if (data_in != NULL && data_out != NULL) {
@@ -113,8 +114,38 @@ bool spi_flash_read_data(uint32_t address, uint8_t *data, uint32_t data_length)
     return status;
 }
 
+bool spi_flash_stream_open(uint32_t address) {
+    // FAST_READ costs a dummy byte after the address, but that's only once per stream, and unlike READ it works at
+    // any clock speed the flash supports.
+    uint8_t request[5] = {CMD_FAST_READ_DATA, 0x00, 0x00, 0x00, 0x00};
+    address_to_bytes(address, request + 1);
+    if (!spi_flash_wait_until_ready()) return false;
+    flash_enable();
+    if (!watch_spi_write(request, 5)) {
+        flash_disable();
+        return false;
+    }
+    return true;
+}
+
+bool spi_flash_stream_read(uint8_t *data, uint16_t data_length) {
+    return watch_spi_read(data, data_length);
+}
+
+void spi_flash_stream_close(void) {
+    flash_disable();
+}
+
+bool spi_flash_wait_until_ready(void) {
+    uint8_t status;
+    do {
+        if (!spi_flash_read_command(CMD_READ_STATUS, &status, 1)) return false;
+    } while (status & SPI_FLASH_STATUS_BUSY);
+    return true;
+}
+
 void spi_flash_init(void) {
-	gpio_set_pin_level(A3, true);
-	gpio_set_pin_direction(A3, GPIO_DIRECTION_OUT);
+    watch_set_pin_level(A3, true);
+    watch_enable_digital_output(A3);
     watch_enable_spi();
 }
@@ -49,10 +49,34 @@
 #define CMD_RESET 0x99
 #define CMD_WAKE 0xab
 
+#define SPI_FLASH_PAGE_SIZE 256     // the most one page program can write
+#define SPI_FLASH_SECTOR_SIZE 4096  // the least one sector erase can erase
+
+#define SPI_FLASH_STATUS_BUSY 0x01
+#define SPI_FLASH_STATUS_WEL 0x02
+
 bool spi_flash_command(uint8_t command);
 bool spi_flash_read_command(uint8_t command, uint8_t *response, uint32_t length);
 bool spi_flash_write_command(uint8_t command, uint8_t *data, uint32_t length);
 bool spi_flash_sector_command(uint8_t command, uint32_t address);
 bool spi_flash_write_data(uint32_t address, uint8_t *data, uint32_t data_length);
 bool spi_flash_read_data(uint32_t address, uint8_t *data, uint32_t data_length);
+
+/** @brief Starts reading the flash sequentially from an address, for reading a lot of it in pieces.
+  * @details spi_flash_read_data sends a command and an address for every read, and selects and deselects the
+  *          chip around it. A stream sends one FAST_READ command, then keeps the chip selected while you call
+  *          spi_flash_stream_read as often as you like; each call picks up where the last one left off, and
+  *          costs nothing but the bytes it reads. Call spi_flash_stream_close when you're done. In between,
+  *          don't call any other function in this file.
+  * @param address The address to start reading at. This waits for any program or erase to finish first.
+  * @return true if the stream is open; false otherwise, in which case don't call spi_flash_stream_close.
+  */
+bool spi_flash_stream_open(uint32_t address);
+/// Reads the next data_length bytes of a stream opened with spi_flash_stream_open.
+bool spi_flash_stream_read(uint8_t *data, uint16_t data_length);
+/// Ends a stream, deselecting the flash.
+void spi_flash_stream_close(void);
+
+/// Polls the status register until the flash has finished programming or erasing.
+bool spi_flash_wait_until_ready(void);
 void spi_flash_init(void);
@@ -0,0 +1,159 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 The Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <string.h>
+#include "spiflash_log.h"
+#include "spiflash.h"
+
+static uint32_t _page_address(uint16_t page) {
+    return (uint32_t)page * SPI_FLASH_LOG_PAGE_SIZE;
+}
+
+static bool _read_header(uint16_t page, spi_flash_log_header_t *header) {
+    return spi_flash_read_data(_page_address(page), (uint8_t *)header, sizeof(spi_flash_log_header_t));
+}
+
+static bool _is_erased(const spi_flash_log_header_t *header) {
+    const uint8_t *bytes = (const uint8_t *)header;
+    for (uint8_t i = 0; i < sizeof(spi_flash_log_header_t); i++) if (bytes[i] != 0xFF) return false;
+    return true;
+}
+
+// whether a page header says the page was written by this log, with records of its size.
+static bool _is_valid(spi_flash_log_t *log, const spi_flash_log_header_t *header) {
+    return header->magic == SPI_FLASH_LOG_MAGIC && header->record_size == log->record_size && header->record_count <= log->records_per_page;
+}
+
+static bool _write_enable(void) {
+    return spi_flash_wait_until_ready() && spi_flash_command(CMD_ENABLE_WRITE);
+}
+
+bool spi_flash_log_mount(spi_flash_log_t *log, uint16_t first_page, uint16_t num_pages, uint8_t record_size) {
+    if (record_size == 0 || record_size > SPI_FLASH_LOG_PAYLOAD_SIZE) return false;
+    if (first_page % SPI_FLASH_LOG_PAGES_PER_SECTOR || num_pages % SPI_FLASH_LOG_PAGES_PER_SECTOR) return false;
+
+    log->first_page = first_page;
+    log->num_pages = num_pages;
+    log->record_size = record_size;
+    log->records_per_page = SPI_FLASH_LOG_PAYLOAD_SIZE / record_size;
+    log->buffered = 0;
+
+    // pages are written in order, so the written ones come first: find the first erased page.
+    if (!spi_flash_wait_until_ready()) return false;
+    uint32_t low = first_page;
+    uint32_t high = (uint32_t)first_page + num_pages;
+    while (low < high) {
+        uint32_t middle = low + (high - low) / 2;
+        spi_flash_log_header_t header;
+        if (!_read_header(middle, &header)) return false;
+        if (_is_erased(&header)) high = middle;
+        else low = middle + 1;
+    }
+    log->next_page = low;
+
+    return true;
+}
+
+static bool _program_page(spi_flash_log_t *log) {
+    if (log->next_page >= log->first_page + log->num_pages) return false;
+
+    // header and records go out together in one page program; bytes past the last record stay erased.
+    spi_flash_log_header_t header;
+    header.magic = SPI_FLASH_LOG_MAGIC;
+    header.record_size = log->record_size;
+    header.record_count = log->buffered;
+    header.sequence = log->next_page - log->first_page;
+    memcpy(log->page, &header, sizeof(header));
+
+    if (!_write_enable()) return false;
+    if (!spi_flash_write_data(_page_address(log->next_page), log->page, sizeof(header) + log->buffered * log->record_size)) return false;
+
+    log->next_page++;
+    log->buffered = 0;
+
+    return true;
+}
+
+bool spi_flash_log_append(spi_flash_log_t *log, const void *record) {
+    if (log->buffered == 0 && log->next_page >= log->first_page + log->num_pages) return false;
+
+    memcpy(log->page + sizeof(spi_flash_log_header_t) + log->buffered * log->record_size, record, log->record_size);
+    log->buffered++;
+    if (log->buffered == log->records_per_page) return _program_page(log);
+
+    return true;
+}
+
+bool spi_flash_log_flush(spi_flash_log_t *log) {
+    if (log->buffered == 0) return true;
+    return _program_page(log);
+}
+
+bool spi_flash_log_read_page(spi_flash_log_t *log, uint16_t index, spi_flash_log_header_t *header, void *records) {
+    if (index >= spi_flash_log_get_page_count(log)) return false;
+
+    uint16_t page = log->first_page + index;
+    if (!spi_flash_wait_until_ready() || !_read_header(page, header)) return false;
+    if (!_is_valid(log, header)) return false;
+
+    return spi_flash_read_data(_page_address(page) + sizeof(spi_flash_log_header_t), records, header->record_count * log->record_size);
+}
+
+bool spi_flash_log_read_all(spi_flash_log_t *log, spi_flash_log_page_cb_t callback, void *context) {
+    uint16_t count = spi_flash_log_get_page_count(log);
+    if (count == 0) return true;
+
+    // the log's pages are next to each other, so we can read them all in a single stream.
+    uint8_t page[SPI_FLASH_LOG_PAGE_SIZE];
+    const spi_flash_log_header_t *header = (const spi_flash_log_header_t *)page;
+    if (!spi_flash_stream_open(_page_address(log->first_page))) return false;
+
+    bool ok = true;
+    for (uint16_t i = 0; ok && i < count; i++) {
+        ok = spi_flash_stream_read(page, sizeof(page)) && _is_valid(log, header) &&
+             callback(header, page + sizeof(spi_flash_log_header_t), context);
+    }
+
+    spi_flash_stream_close();
+    return ok;
+}
+
+uint16_t spi_flash_log_get_page_count(spi_flash_log_t *log) {
+    return log->next_page - log->first_page;
+}
+
+uint16_t spi_flash_log_get_free_pages(spi_flash_log_t *log) {
+    return log->num_pages - spi_flash_log_get_page_count(log);
+}
+
+bool spi_flash_log_erase(spi_flash_log_t *log) {
+    for (uint16_t page = log->first_page; page < log->first_page + log->num_pages; page += SPI_FLASH_LOG_PAGES_PER_SECTOR) {
+        if (!_write_enable()) return false;
+        if (!spi_flash_sector_command(CMD_SECTOR_ERASE, _page_address(page))) return false;
+    }
+    log->next_page = log->first_page;
+    log->buffered = 0;
+
+    return spi_flash_wait_until_ready();
+}
@@ -0,0 +1,119 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2026 The Sensor Watch contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#ifndef SPIFLASH_LOG_H
+#define SPIFLASH_LOG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// An append-only log of fixed-size records in a range of pages on the SPI flash. Each page starts with a header
+// that says what's in it, and pages fill up in order, so the first erased page is the end of the log; mounting
+// finds it with a binary search over the page headers instead of keeping a separate map of used pages. Records
+// collect in RAM until they fill a page, which then goes out with a single page program.
+
+#define SPI_FLASH_LOG_PAGE_SIZE 256
+#define SPI_FLASH_LOG_SECTOR_SIZE 4096
+#define SPI_FLASH_LOG_PAGES_PER_SECTOR (SPI_FLASH_LOG_SECTOR_SIZE / SPI_FLASH_LOG_PAGE_SIZE)
+#define SPI_FLASH_LOG_MAGIC 0x4C53 // "SL"
+
+typedef struct {
+    uint16_t magic;         // SPI_FLASH_LOG_MAGIC on a page the log wrote; 0xFFFF on an erased one
+    uint8_t record_size;    // size of each record in the page, in bytes
+    uint8_t record_count;   // number of records in the page
+    uint32_t sequence;      // number of log pages written before this one
+} spi_flash_log_header_t;
+
+#define SPI_FLASH_LOG_PAYLOAD_SIZE (SPI_FLASH_LOG_PAGE_SIZE - sizeof(spi_flash_log_header_t))
+
+typedef struct {
+    uint16_t first_page;    // the log's range of pages on the flash
+    uint16_t num_pages;
+    uint16_t next_page;     // the append cursor: the first erased page, or first_page + num_pages when full
+    uint8_t record_size;
+    uint8_t records_per_page;
+    uint8_t buffered;       // records waiting in page for the next page program
+    uint8_t page[SPI_FLASH_LOG_PAGE_SIZE];  // the next page to program: room for its header, then the records
+} spi_flash_log_t;
+
+/** @brief Sets up a log over a range of pages, and finds the end of whatever is already in it.
+  * @details Reads the header of about log2(num_pages) pages. Anything in the range that isn't erased counts as
+  *          written, so the log never programs over data it doesn't know about.
+  * @param log The log to set up.
+  * @param first_page The first page of the range; must be at the start of a 4 KB sector.
+  * @param num_pages The number of pages in the range; must be a whole number of sectors.
+  * @param record_size The size of each record, from 1 to SPI_FLASH_LOG_PAYLOAD_SIZE bytes.
+  * @return true if the log is ready for use, false if the parameters are invalid or the flash didn't respond.
+  */
+bool spi_flash_log_mount(spi_flash_log_t *log, uint16_t first_page, uint16_t num_pages, uint8_t record_size);
+
+/** @brief Adds a record to the log. When it fills a page, the page is programmed right away.
+  * @return true if the record was added, false if the log is full.
+  */
+bool spi_flash_log_append(spi_flash_log_t *log, const void *record);
+
+/** @brief Programs any buffered records into a page of their own, e.g. at the end of a session. The next
+  *        record starts a new page.
+  * @return true if there was nothing to do or the page was written, false if the log is full.
+  */
+bool spi_flash_log_flush(spi_flash_log_t *log);
+
+/** @brief Reads one page of the log.
+  * @param log The log.
+  * @param index The page to read, counting from the start of the log.
+  * @param header Receives the page's header.
+  * @param records Receives the page's records; it needs room for log->records_per_page of them.
+  * @return true if the page was written by a log like this one; false if it is past the end of the log, or
+  *         holds something else.
+  */
+bool spi_flash_log_read_page(spi_flash_log_t *log, uint16_t index, spi_flash_log_header_t *header, void *records);
+
+/** @brief Called by spi_flash_log_read_all with each page of the log, in order.
+  * @details The flash is still selected while this runs, so it mustn't call into spiflash.h or this file.
+  * @return true to go on to the next page, false to stop.
+  */
+typedef bool (*spi_flash_log_page_cb_t)(const spi_flash_log_header_t *header, const void *records, void *context);
+
+/** @brief Reads the whole log, front to back, e.g. to dump it over USB.
+  * @details This reads the log in one stream (see spi_flash_stream_open), so it is much cheaper than calling
+  *          spi_flash_log_read_page for each page, which sends three commands per page.
+  * @param log The log.
+  * @param callback Called with each page's header and records.
+  * @param context Passed along to callback.
+  * @return true if every page was read; false if a page holds something else, the callback stopped early, or
+  *         the flash didn't respond.
+  */
+bool spi_flash_log_read_all(spi_flash_log_t *log, spi_flash_log_page_cb_t callback, void *context);
+
+/// @return The number of pages written to the log so far.
+uint16_t spi_flash_log_get_page_count(spi_flash_log_t *log);
+
+/// @return The number of pages left in the log.
+uint16_t spi_flash_log_get_free_pages(spi_flash_log_t *log);
+
+/** @brief Erases every sector in the log's range, and starts it over, discarding any buffered records.
+  */
+bool spi_flash_log_erase(spi_flash_log_t *log);
+
+#endif // SPIFLASH_LOG_H
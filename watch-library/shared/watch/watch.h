@@ -88,6 +88,25 @@ bool watch_is_usb_enabled(void);
   */
 void watch_reset_to_bootloader(void);
 
+/** @brief Commits the display, then waits for the given number of milliseconds in ACTIVE mode.
+  * @details Use this instead of delay_ms when you draw something and then wait, so that what you drew is on
+  *          screen while you wait; see watch_display_commit.
+  */
+void watch_delay_ms(const uint16_t ms);
+
+/** @brief Returns a free-running count, for measuring how long a stretch of code takes to run.
+  * @details On hardware this counts core clock cycles on the SysTick timer. The simulator counts microseconds
+  *          and the host build counts nanoseconds of real (not virtual) time, since neither has a cycle counter.
+  *          The count wraps around, so use watch_get_cycles_since to measure a span.
+  */
+uint32_t watch_get_cycle_count(void);
+
+/** @brief Returns how far the count from watch_get_cycle_count has moved since start.
+  * @note SysTick is a 24-bit counter, so on hardware this can only measure spans of up to 2^24 cycles, or
+  *       about four seconds at 4 MHz. Anything longer wraps around.
+  */
+uint32_t watch_get_cycles_since(uint32_t start);
+
 /** @brief Call periodically from app main loop to service CDC RX/TX.
   */
 void cdc_task(void);
@@ -102,6 +121,6 @@ int read(int file, char *ptr, int len);
 
 /** @brief Disables the TRNG twice in order to work around silicon erratum 1.16.1.
  */
-void watch_disable_TRNG();
+void watch_disable_TRNG(void);
 
 #endif /* WATCH_H_ */
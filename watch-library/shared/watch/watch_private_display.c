@@ -24,6 +24,7 @@
 
 #include "watch_slcd.h"
 #include "watch_private_display.h"
+#include "watch_display_tables.h"
 
 static const uint32_t IndicatorSegments[] = {
     SLCD_SEGID(0, 17), // WATCH_INDICATOR_SIGNAL
@@ -33,94 +34,59 @@ static const uint32_t IndicatorSegments[] = {
     SLCD_SEGID(1, 10), // WATCH_INDICATOR_LAP
 };
 
-void watch_display_character(uint8_t character, uint8_t position) {
-    // special cases for positions 4 and 6
-    if (position == 4 || position == 6) {
-        if (character == '7') character = '&'; // "lowercase" 7
-        else if (character == 'A') character = 'a'; // A needs to be lowercase
-        else if (character == 'o') character = 'O'; // O needs to be uppercase
-        else if (character == 'L') character = '!'; // L needs to be in top half
-        else if (character == 'M' || character == 'm' || character == 'N') character = 'n'; // M and uppercase N need to be lowercase n
-        else if (character == 'c') character = 'C'; // C needs to be uppercase
-        else if (character == 'J') character = 'j'; // same
-        else if (character == 'v' || character == 'V' || character == 'U' || character == 'W' || character == 'w') character = 'u'; // bottom segment duplicated, so show in top half
-    } else {
-        if (character == 'u') character = 'v'; // we can use the bottom segment; move to lower half
-        else if (character == 'j') character = 'J'; // same but just display a normal J
-    }
-    if (position > 1) {
-        if (character == 'T') character = 't'; // uppercase T only works in positions 0 and 1
-    }
-    if (position == 1) {
-        if (character == 'a') character = 'A'; // A needs to be uppercase
-        else if (character == 'o') character = 'O'; // O needs to be uppercase
-        else if (character == 'i') character = 'l'; // I needs to be uppercase (use an l, it looks the same)
-        else if (character == 'n') character = 'N'; // N needs to be uppercase
-        else if (character == 'r') character = 'R'; // R needs to be uppercase
-        else if (character == 'd') character = 'D'; // D needs to be uppercase
-        else if (character == 'v' || character == 'V' || character == 'u') character = 'U'; // side segments shared, make uppercase
-        else if (character == 'b') character = 'B'; // B needs to be uppercase
-        else if (character == 'c') character = 'C'; // C needs to be uppercase
-    } else {
-        if (character == 'R') character = 'r'; // R needs to be lowercase almost everywhere
-    }
-    if (position == 0) {
-        watch_clear_pixel(0, 15); // clear funky ninth segment
-    } else {
-        if (character == 'I') character = 'l'; // uppercase I only works in position 0
-    }
+uint32_t Segment_Data[3];
 
-    uint64_t segmap = Segment_Map[position];
-    uint64_t segdata = Character_Set[character - 0x20];
-
-    for (int i = 0; i < 8; i++) {
-        uint8_t com = (segmap & 0xFF) >> 6;
-        if (com > 2) {
-            // COM3 means no segment exists; skip it.
-            segmap = segmap >> 8;
-            segdata = segdata >> 1;
-            continue;
-        }
-        uint8_t seg = segmap & 0x3F;
-
-        if (segdata & 1)
-          watch_set_pixel(com, seg);
-        else
-          watch_clear_pixel(com, seg);
-
-        segmap = segmap >> 8;
-        segdata = segdata >> 1;
-    }
+// how many watch_display_begin_frame calls have yet to be matched by a watch_display_commit_frame.
+static uint8_t _frame_depth;
+
+void watch_set_pixel(uint8_t com, uint8_t seg) {
+    if (com > 2 || seg > 31) return;
+    Segment_Data[com] |= 1ul << seg;
+}
+
+void watch_clear_pixel(uint8_t com, uint8_t seg) {
+    if (com > 2 || seg > 31) return;
+    Segment_Data[com] &= ~(1ul << seg);
+}
 
-    if (character == 'T' && position == 1) watch_set_pixel(1, 12); // add descender
-    else if (position == 0 && (character == 'B' || character == 'D' || character == '@')) watch_set_pixel(0, 15); // add funky ninth segment
-    else if (position == 1 && (character == 'B' || character == 'D' || character == '@')) watch_set_pixel(0, 12); // add funky ninth segment
+void watch_clear_display(void) {
+    Segment_Data[0] = 0;
+    Segment_Data[1] = 0;
+    Segment_Data[2] = 0;
+}
+
+void watch_display_commit(void) {
+    if (_frame_depth) return;
+    _watch_display_write_segments();
+}
+
+void watch_display_begin_frame(void) {
+    _frame_depth++;
+}
+
+void watch_display_commit_frame(void) {
+    if (_frame_depth && --_frame_depth) return;
+    _watch_display_write_segments();
+}
+
+void watch_display_character(uint8_t character, uint8_t position) {
+    if (position >= Num_Chars) return;
+    if (character < DISPLAY_TABLE_FIRST_CHARACTER || character >= DISPLAY_TABLE_FIRST_CHARACTER + DISPLAY_TABLE_NUM_CHARACTERS) character = ' ';
+
+    // the tables have the substitutions for each position (lowercase R, descender on T, etc.) baked in;
+    // see utils/segment_tables.py.
+    const uint32_t *clear = Display_Clear[position];
+    const uint16_t *set = Display_Set[position][character - DISPLAY_TABLE_FIRST_CHARACTER];
+    uint8_t shift = Display_Shift[position];
+
+    Segment_Data[0] = (Segment_Data[0] & ~clear[0]) | ((uint32_t)set[0] << shift);
+    Segment_Data[1] = (Segment_Data[1] & ~clear[1]) | ((uint32_t)set[1] << shift);
+    Segment_Data[2] = (Segment_Data[2] & ~clear[2]) | ((uint32_t)set[2] << shift);
 }
 
 void watch_display_character_lp_seconds(uint8_t character, uint8_t position) {
-    // Will only work for digits and for positions  8 and 9 - but less code & checks to reduce power consumption
-
-    uint64_t segmap = Segment_Map[position];
-    uint64_t segdata = Character_Set[character - 0x20];
-
-    for (int i = 0; i < 8; i++) {
-        uint8_t com = (segmap & 0xFF) >> 6;
-        if (com > 2) {
-            // COM3 means no segment exists; skip it.
-            segmap = segmap >> 8;
-            segdata = segdata >> 1;
-            continue;
-        }
-        uint8_t seg = segmap & 0x3F;
-
-        if (segdata & 1)
-          watch_set_pixel(com, seg);
-        else
-          watch_clear_pixel(com, seg);
-
-        segmap = segmap >> 8;
-        segdata = segdata >> 1;
-    }
+    // this used to skip the substitution rules to save power; with those in the tables, it's the same thing.
+    watch_display_character(character, position);
 }
 
 void watch_display_string(char *string, uint8_t position) {
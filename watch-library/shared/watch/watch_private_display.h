@@ -141,6 +141,13 @@ static const uint64_t Segment_Map[] = {
 
 static const uint8_t Num_Chars = 10;
 
+// The segment data for COM0-2, one bit per SEG: the display as the app has drawn it.
+extern uint32_t Segment_Data[3];
+
+// Each platform's way of getting Segment_Data onto the display; watch_display_commit and
+// watch_display_commit_frame call this when no frame is open.
+void _watch_display_write_segments(void);
+
 void watch_display_character(uint8_t character, uint8_t position);
 void watch_display_character_lp_seconds(uint8_t character, uint8_t position);
 
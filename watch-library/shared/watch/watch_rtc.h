@@ -147,6 +147,30 @@ void watch_rtc_disable_matching_periodic_callbacks(uint8_t mask);
   */
 void watch_rtc_disable_all_periodic_callbacks(void);
 
+/** @brief Returns a running count of 1/128 second ticks, for timing things that are shorter than a second.
+  * @details The count wraps around, so compare two values by subtracting them, not with < or >.
+  * @note The SAM L22's RTC has no sub-second counter in clock mode, so this count is kept by the 128 Hz periodic
+  *       interrupt, and only moves while a timeout callback or a 128 Hz periodic callback is enabled. The host
+  *       build does the same. That's enough to measure anything a pending timeout covers (i.e. how long a button has been
+  *       held), but it is not a clock you can read at any time.
+  */
+uint32_t watch_rtc_get_ticks(void);
+
+/** @brief Registers a callback that will be called once, after the given number of 1/128 second ticks.
+  * @param callback The function you wish to have called when the timeout expires.
+  * @param ticks How many ticks from now the callback should fire. 0 is treated as 1.
+  * @details There is one timeout; registering a new one replaces any that is pending. Unlike a 128 Hz periodic
+  *          callback, nothing runs on each tick, and the 128 Hz interrupt stops as soon as the timeout fires or is
+  *          disabled. The ticks are still counted by the RTC's 128 Hz periodic interrupt, though, so the core wakes
+  *          128 times a second while a timeout is pending; the host build charges those wakeups too. Only the
+  *          simulator uses a true one-shot timer.
+  */
+void watch_rtc_register_timeout_callback(ext_irq_cb_t callback, uint16_t ticks);
+
+/** @brief Disables the timeout callback, if one is pending.
+  */
+void watch_rtc_disable_timeout_callback(void);
+
 /** @brief Enable/disable RTC while in-flight. This is quite dangerous operation, so we repeat writing register twice.
  * Used when temporarily pausing RTC when adjusting subsecond, which are not accessible otherwise.
   */
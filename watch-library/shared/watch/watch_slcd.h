@@ -73,6 +73,29 @@ void watch_clear_pixel(uint8_t com, uint8_t seg);
   */
 void watch_clear_display(void);
 
+/** @brief Pushes pending pixel changes out to the display.
+  * @details The functions above only update a copy of the SLCD's segment data in RAM. This function
+  *          compares that copy with what the SLCD is showing, and writes only the data registers whose
+  *          contents have changed. The watch library calls it after each pass through app_loop, in
+  *          watch_delay_ms and before entering sleep mode, so you only need to call it yourself if you want
+  *          a change to appear in the middle of some long-running work. It does nothing while a frame is
+  *          open; see watch_display_begin_frame.
+  */
+void watch_display_commit(void);
+
+/** @brief Starts a frame: nothing you draw from here on reaches the display until the matching call to
+  *        watch_display_commit_frame, even if you call watch_delay_ms or watch_display_commit in between.
+  * @details Use this for animations, so that the display never shows half of one frame and half of the
+  *          next. Frames nest; only the outermost commit writes to the display.
+  */
+void watch_display_begin_frame(void);
+
+/** @brief Ends a frame started with watch_display_begin_frame, and writes everything drawn since then to
+  *        the display in one go. On the watch, the SLCD shows the new segment data from the start of its next
+  *        frame, all at once.
+  */
+void watch_display_commit_frame(void);
+
 /** @brief Displays a string at the given position, starting from the top left. There are ten digits.
            A space in any position will clear that digit.
   * @param string A null-terminated string.
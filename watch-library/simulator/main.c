@@ -23,66 +23,166 @@
  */
 
 #include <stdio.h>
+#include <math.h>
 #include "watch.h"
 #include "watch_main_loop.h"
 
 #include <emscripten.h>
 #include <emscripten/html5.h>
 
-#define ANIMATION_FRAME_ID_IS_VALID(id) ((id) >= 0)
-#define ANIMATION_FRAME_ID_INVALID (-1)
-#define ANIMATION_FRAME_ID_SUSPENDED (-2)
-
+typedef struct {
+    main_loop_timer_cb callback;
+    void *user_data;
+    double deadline;    // in emscripten_get_now() milliseconds
+    double period;      // 0 for a one-shot timer
+    bool armed;
+    bool wakes_core;    // false for peripherals that run on their own
+} main_loop_timer_t;
+
+static main_loop_timer_t timers[MAIN_LOOP_MAX_TIMERS];
+
+// the one browser timeout we keep armed, for whichever comes first: a timer, or the next pass through app_loop.
+static long browser_timeout_id = -1;
+static double browser_timeout_deadline;
+
+// when app_loop should run next, or INFINITY if nothing has asked for it.
+static double next_pass = INFINITY;
+// whether the last pass ended with the app unable to sleep.
+static bool stayed_awake = false;
+static bool in_app_loop = false;
 static bool sleeping = true;
-static volatile long animation_frame_id = ANIMATION_FRAME_ID_INVALID;
 
 // make compiler happy
 static void main_loop_set_sleeping(bool sleeping);
-static EM_BOOL main_loop(double time, void *userData);
+static void schedule(void);
+
+static int8_t set_timer(main_loop_timer_cb callback, void *user_data, double delay_ms, double period_ms, bool wakes_core) {
+    for (int8_t i = 0; i < MAIN_LOOP_MAX_TIMERS; i++) {
+        if (!timers[i].armed) {
+            timers[i].callback = callback;
+            timers[i].user_data = user_data;
+            timers[i].deadline = emscripten_get_now() + delay_ms;
+            timers[i].period = period_ms;
+            timers[i].armed = true;
+            timers[i].wakes_core = wakes_core;
+            schedule();
+            return i;
+        }
+    }
+
+    return -1;
+}
 
-static inline void request_next_frame(void) {
-    if (animation_frame_id == ANIMATION_FRAME_ID_INVALID) {
-        animation_frame_id = emscripten_request_animation_frame(main_loop, NULL);
+int8_t main_loop_set_timer(main_loop_timer_cb callback, void *user_data, double delay_ms, double period_ms) {
+    return set_timer(callback, user_data, delay_ms, period_ms, true);
+}
+
+int8_t main_loop_set_peripheral_timer(main_loop_timer_cb callback, void *user_data, double delay_ms, double period_ms) {
+    return set_timer(callback, user_data, delay_ms, period_ms, false);
+}
+
+void main_loop_clear_timer(int8_t timer_id) {
+    if (timer_id < 0 || timer_id >= MAIN_LOOP_MAX_TIMERS) return;
+    timers[timer_id].armed = false;
+    // no need to reschedule; if this was the next timer due, the browser timeout will just find nothing to do.
+}
+
+static int8_t next_timer(void) {
+    int8_t next = -1;
+    for (int8_t i = 0; i < MAIN_LOOP_MAX_TIMERS; i++) {
+        if (timers[i].armed && (next < 0 || timers[i].deadline < timers[next].deadline)) next = i;
     }
+
+    return next;
 }
 
-static EM_BOOL main_loop(double time, void *userData) {
-    if (main_loop_is_sleeping()) {
-        request_next_frame();
-        return EM_FALSE;
+static void fire_timers_due(double now) {
+    // a callback may arm or clear other timers, so we rescan the table after each one.
+    int8_t i;
+    while ((i = next_timer()) >= 0 && timers[i].deadline <= now) {
+        main_loop_timer_t *timer = &timers[i];
+        main_loop_timer_cb callback = timer->callback;
+        void *user_data = timer->user_data;
+        bool wakes_core = timer->wakes_core;
+
+        if (timer->period > 0) {
+            // if the tab was in the background and we missed some periods, fire once and carry on from now.
+            timer->deadline += timer->period;
+            if (timer->deadline <= now) timer->deadline = now + timer->period;
+        } else {
+            timer->armed = false;
+        }
+
+        callback(user_data);
+        if (wakes_core) resume_main_loop();
     }
+}
+
+static void run_pass(void) {
+    next_pass = INFINITY;
 
     if (sleeping) {
         sleeping = false;
         app_wake_from_standby();
     }
 
-    animation_frame_id = ANIMATION_FRAME_ID_INVALID;
+    in_app_loop = true;
     bool can_sleep = app_loop();
+    watch_display_commit();
+    in_app_loop = false;
 
     if (can_sleep) {
         app_prepare_for_standby();
         sleeping = true;
-        animation_frame_id = ANIMATION_FRAME_ID_INVALID;
-        return EM_FALSE;
+        stayed_awake = false;
+        return;
     }
 
-    request_next_frame();
-    return EM_FALSE;
+    // the watch would go straight around again. we do that once, to pick up a face change or events that came in
+    // during this pass, and after that we only poll now and then until the app is ready to sleep.
+    double next = emscripten_get_now() + (stayed_awake ? MAIN_LOOP_AWAKE_POLL_MS : 0);
+    stayed_awake = true;
+    if (next < next_pass) next_pass = next;
 }
 
-void resume_main_loop(void) {
-    if (!ANIMATION_FRAME_ID_IS_VALID(animation_frame_id)) {
-        animation_frame_id = emscripten_request_animation_frame(main_loop, NULL);
-    }
+static void on_browser_timeout(void *userData) {
+    browser_timeout_id = -1;
+
+    double now = emscripten_get_now();
+    fire_timers_due(now);
+    // timers can fire while app_loop is waiting in delay_ms; it picks up what they did when it gets going again.
+    if (!in_app_loop && next_pass <= now) run_pass();
+
+    schedule();
 }
 
-void suspend_main_loop(void) {
-    if (ANIMATION_FRAME_ID_IS_VALID(animation_frame_id)) {
-        emscripten_cancel_animation_frame(animation_frame_id);
+static void schedule(void) {
+    double deadline = in_app_loop ? INFINITY : next_pass;
+    int8_t i = next_timer();
+    if (i >= 0 && timers[i].deadline < deadline) deadline = timers[i].deadline;
+
+    if (browser_timeout_id != -1) {
+        if (browser_timeout_deadline == deadline) return;
+        emscripten_clear_timeout(browser_timeout_id);
+        browser_timeout_id = -1;
     }
+    if (deadline == INFINITY) return;
 
-    animation_frame_id = ANIMATION_FRAME_ID_SUSPENDED;
+    double delay = deadline - emscripten_get_now();
+    browser_timeout_deadline = deadline;
+    browser_timeout_id = emscripten_set_timeout(on_browser_timeout, delay > 0 ? delay : 0, NULL);
+}
+
+void resume_main_loop(void) {
+    double now = emscripten_get_now();
+    stayed_awake = false;
+    if (now < next_pass) next_pass = now;
+    schedule();
+}
+
+void suspend_main_loop(void) {
+    next_pass = INFINITY;
+    schedule();
 }
 
 void main_loop_sleep(uint32_t ms) {
@@ -1,3 +1,4 @@
+#include <emscripten.h>
 #include "watch.h"
 
 bool watch_is_buzzer_or_led_enabled(void) {
@@ -11,3 +12,16 @@ bool watch_is_usb_enabled(void) {
 void watch_reset_to_bootloader(void) {
     // No bootloader in the simulator; nothing to do here
 }
+
+void watch_delay_ms(const uint16_t ms) {
+    watch_display_commit();
+    delay_ms(ms);
+}
+
+uint32_t watch_get_cycle_count(void) {
+    return (uint32_t)(emscripten_get_now() * 1000.0);
+}
+
+uint32_t watch_get_cycles_since(uint32_t start) {
+    return watch_get_cycle_count() - start;
+}
@@ -36,17 +36,17 @@ void cb_watch_buzzer_seq(void *userData);
 
 static uint16_t _seq_position;
 static int8_t _tone_ticks, _repeat_counter;
-static long _em_interval_id = 0;
+static int8_t _em_interval_id = -1;
 static int8_t *_sequence;
 static void (*_cb_finished)(void);
 
 static inline void _em_interval_stop() {
-    emscripten_clear_interval(_em_interval_id);
-    _em_interval_id = 0;
+    main_loop_clear_timer(_em_interval_id);
+    _em_interval_id = -1;
 }
 
 void watch_buzzer_play_sequence(int8_t *note_sequence, void (*callback_on_end)(void)) {
-    if (_em_interval_id) _em_interval_stop();
+    if (_em_interval_id != -1) _em_interval_stop();
     watch_set_buzzer_off();
     _sequence = note_sequence;
     _cb_finished = callback_on_end;
@@ -56,7 +56,7 @@ void watch_buzzer_play_sequence(int8_t *note_sequence, void (*callback_on_end)(v
     // prepare buzzer
     watch_enable_buzzer();
     // initiate 64 hz callback
-    _em_interval_id = emscripten_set_interval(cb_watch_buzzer_seq, (double)(1000/64), (void *)NULL);
+    _em_interval_id = main_loop_set_timer(cb_watch_buzzer_seq, NULL, 1000.0 / 64, 1000.0 / 64);
 }
 
 void cb_watch_buzzer_seq(void *userData) {
@@ -103,7 +103,7 @@ void cb_watch_buzzer_seq(void *userData) {
 
 void watch_buzzer_abort_sequence(void) {
     // ends/aborts the sequence
-    if (_em_interval_id) _em_interval_stop();
+    if (_em_interval_id != -1) _em_interval_stop();
     watch_set_buzzer_off();
 }
 
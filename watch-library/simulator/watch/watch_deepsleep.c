@@ -62,6 +62,7 @@ uint32_t watch_get_backup_data(uint8_t reg) {
 
 void watch_enter_sleep_mode(void) {
     // TODO: (a2) hook to UI
+    watch_display_commit();
 
     // enter standby (4); we basically hang out here until an interrupt wakes us.
     // sleep(4);
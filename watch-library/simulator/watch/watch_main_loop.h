@@ -24,8 +24,33 @@
 
 #include "driver_init.h"
 
+// The simulator's scheduler works like the watch: every RTC tick, alarm, timeout, buzzer step and so on is a
+// timer in one table, and a single browser timeout is armed for whichever comes due first. When a timer fires,
+// it counts as an interrupt, and app_loop runs once it returns. Between interrupts, nothing runs at all.
+
+/// The maximum number of timers that can be armed at once.
+#define MAIN_LOOP_MAX_TIMERS 16
+
+/// While the app says it can't sleep, how often we go around app_loop anyway, in milliseconds.
+#define MAIN_LOOP_AWAKE_POLL_MS (1000.0 / 16)
+
+typedef void (*main_loop_timer_cb)(void *user_data);
+
+/// Arms a timer that fires after delay_ms, and then every period_ms unless that is 0. When it fires, app_loop
+/// runs afterwards. Returns an ID for main_loop_clear_timer, or -1 if all timers are in use.
+int8_t main_loop_set_timer(main_loop_timer_cb callback, void *user_data, double delay_ms, double period_ms);
+
+/// Same as main_loop_set_timer, for peripherals that do their work on their own (i.e. the SLCD's blink and
+/// tick animations) and so don't need app_loop to run when they fire.
+int8_t main_loop_set_peripheral_timer(main_loop_timer_cb callback, void *user_data, double delay_ms, double period_ms);
+
+/// Disarms a timer. Passing -1 is a no-op, so you can call this on a timer you never armed.
+void main_loop_clear_timer(int8_t timer_id);
+
+/// Cancels the pass through app_loop that an interrupt has requested, if any.
 void suspend_main_loop(void);
 
+/// Requests a pass through app_loop as soon as possible; call this after servicing an interrupt that isn't a timer.
 void resume_main_loop(void);
 
 void main_loop_sleep(uint32_t ms);
@@ -29,10 +29,12 @@
 #include <emscripten/html5.h>
 
 static double time_offset = 0;
-static long tick_callbacks[8] = { -1, -1, -1, -1, -1, -1, -1, -1 };
+static int8_t tick_callbacks[8] = { -1, -1, -1, -1, -1, -1, -1, -1 };
 
-static long alarm_interval_id = -1;
-static long alarm_timeout_id = -1;
+static int8_t timeout_id = -1;
+static ext_irq_cb_t timeout_callback;
+
+static int8_t alarm_timer_id = -1;
 static double alarm_interval;
 ext_irq_cb_t alarm_callback;
 ext_irq_cb_t btn_alarm_callback;
@@ -84,7 +86,6 @@ void watch_rtc_disable_tick_callback(void) {
 static void watch_invoke_periodic_callback(void *userData) {
     ext_irq_cb_t callback = userData;
     callback();
-    resume_main_loop();
 }
 
 void watch_rtc_register_periodic_callback(ext_irq_cb_t callback, uint8_t frequency) {
@@ -99,15 +100,15 @@ void watch_rtc_register_periodic_callback(ext_irq_cb_t callback, uint8_t frequen
 
     double interval = 1000.0 / frequency; // in msec
 
-    if (tick_callbacks[per_n] != -1) emscripten_clear_interval(tick_callbacks[per_n]);
-    tick_callbacks[per_n] = emscripten_set_interval(watch_invoke_periodic_callback, interval, (void *)callback);
+    if (tick_callbacks[per_n] != -1) main_loop_clear_timer(tick_callbacks[per_n]);
+    tick_callbacks[per_n] = main_loop_set_timer(watch_invoke_periodic_callback, (void *)callback, interval, interval);
 }
 
 void watch_rtc_disable_periodic_callback(uint8_t frequency) {
     if (__builtin_popcount(frequency) != 1) return;
     uint8_t per_n = __builtin_clz((frequency & 0xFF) << 24);
     if (tick_callbacks[per_n] != -1) {
-        emscripten_clear_interval(tick_callbacks[per_n]);
+        main_loop_clear_timer(tick_callbacks[per_n]);
         tick_callbacks[per_n] = -1;
     }
 }
@@ -115,7 +116,7 @@ void watch_rtc_disable_periodic_callback(uint8_t frequency) {
 void watch_rtc_disable_matching_periodic_callbacks(uint8_t mask) {
     for (int i = 0; i < 8; i++) {
         if (tick_callbacks[i] != -1 && (mask & (1 << i)) != 0) {
-            emscripten_clear_interval(tick_callbacks[i]);
+            main_loop_clear_timer(tick_callbacks[i]);
             tick_callbacks[i] = -1;
         }
     }
@@ -125,13 +126,33 @@ void watch_rtc_disable_all_periodic_callbacks(void) {
     watch_rtc_disable_matching_periodic_callbacks(0xFF);
 }
 
-static void watch_invoke_alarm_interval_callback(void *userData) {
-    if (alarm_callback) alarm_callback();
+uint32_t watch_rtc_get_ticks(void) {
+    return (uint32_t)(emscripten_get_now() * 128 / 1000);
+}
+
+static void watch_invoke_timeout_callback(void *userData) {
+    ext_irq_cb_t callback = timeout_callback;
+    timeout_id = -1;
+    timeout_callback = NULL;
+    if (callback) callback();
+}
+
+void watch_rtc_register_timeout_callback(ext_irq_cb_t callback, uint16_t ticks) {
+    watch_rtc_disable_timeout_callback();
+    timeout_callback = callback;
+    timeout_id = main_loop_set_timer(watch_invoke_timeout_callback, NULL, (ticks ? ticks : 1) * 1000.0 / 128, 0);
+}
+
+void watch_rtc_disable_timeout_callback(void) {
+    if (timeout_id != -1) {
+        main_loop_clear_timer(timeout_id);
+        timeout_id = -1;
+    }
+    timeout_callback = NULL;
 }
 
 static void watch_invoke_alarm_callback(void *userData) {
     if (alarm_callback) alarm_callback();
-    alarm_interval_id = emscripten_set_interval(watch_invoke_alarm_interval_callback, alarm_interval, NULL);
 }
 
 void watch_rtc_register_alarm_callback(ext_irq_cb_t callback, watch_date_time alarm_time, watch_rtc_alarm_match mask) {
@@ -179,21 +200,17 @@ void watch_rtc_register_alarm_callback(ext_irq_cb_t callback, watch_date_time al
     }, time_offset, alarm_time.reg, mask);
 
     alarm_callback = callback;
-    alarm_timeout_id = emscripten_set_timeout(watch_invoke_alarm_callback, timeout, NULL);
+    // first match after timeout ms, then every alarm_interval after that.
+    alarm_timer_id = main_loop_set_timer(watch_invoke_alarm_callback, NULL, timeout, alarm_interval);
 }
 
 void watch_rtc_disable_alarm_callback(void) {
     alarm_callback = NULL;
     alarm_interval = 0;
 
-    if (alarm_timeout_id != -1) {
-        emscripten_clear_timeout(alarm_timeout_id);
-        alarm_timeout_id = -1;
-    }
-
-    if (alarm_interval_id != -1) {
-        emscripten_clear_interval(alarm_interval_id);
-        alarm_interval_id = -1;
+    if (alarm_timer_id != -1) {
+        main_loop_clear_timer(alarm_timer_id);
+        alarm_timer_id = -1;
     }
 }
 
@@ -22,9 +22,11 @@
  * SOFTWARE.
  */
 
+#include <string.h>
 #include "watch_slcd.h"
 #include "watch_private_display.h"
 #include "hpl_slcd_config.h"
+#include "watch_main_loop.h"
 
 #include <emscripten.h>
 #include <emscripten/html5.h>
@@ -34,39 +36,65 @@
 
 static char blink_character;
 static bool blink_state;
-static long blink_interval_id = - 1;
+static int8_t blink_interval_id = -1;
 static bool tick_state;
-static long tick_interval_id = -1;
+static int8_t tick_interval_id = -1;
 
-void watch_enable_display(void) {
-    watch_clear_display();
-}
+// What the page is showing, and what the app last committed. Each animation frame, we update only the
+// segments that differ between the two.
+static uint32_t _slcd_committed[3];
+static uint32_t _slcd_pending[3];
+static long _slcd_flush_id = -1;
 
-void watch_set_pixel(uint8_t com, uint8_t seg) {
+void watch_enable_display(void) {
+    // look up the elements for each COM/SEG pair once, so that drawing doesn't have to query the DOM.
+    // Module['segments'][com * 32 + seg] lists the elements that make up that segment.
     EM_ASM({
-        document.querySelectorAll("[data-com='" + $0 + "'][data-seg='" + $1 + "']")
-            .forEach((e) => e.style.opacity = 1);
-    }, com, seg);
+        if (!Module['segments']) {
+            Module['segments'] = [];
+            document.querySelectorAll("[data-com][data-seg]").forEach((e) => {
+                const index = Number(e.dataset.com) * 32 + Number(e.dataset.seg);
+                (Module['segments'][index] = Module['segments'][index] || []).push(e);
+            });
+        }
+        Module['segments'].forEach((elements) => elements.forEach((e) => e.style.opacity = 0));
+    });
+    watch_clear_display();
+    memset(_slcd_committed, 0, sizeof(_slcd_committed));
+    memset(_slcd_pending, 0, sizeof(_slcd_pending));
 }
 
-void watch_clear_pixel(uint8_t com, uint8_t seg) {
+static EM_BOOL _watch_display_flush(double time, void *userData) {
+    _slcd_flush_id = -1;
     EM_ASM({
-        document.querySelectorAll("[data-com='" + $0 + "'][data-seg='" + $1 + "']")
-            .forEach((e) => e.style.opacity = 0);
-    }, com, seg);
+        const data = [$0, $1, $2];
+        const changed = [$3, $4, $5];
+        for (let com = 0; com < 3; com++) {
+            for (let seg = 0; seg < 32; seg++) {
+                if (!((changed[com] >>> seg) & 1)) continue;
+                (Module['segments'][com * 32 + seg] || []).forEach((e) => e.style.opacity = (data[com] >>> seg) & 1);
+            }
+        }
+    }, _slcd_pending[0], _slcd_pending[1], _slcd_pending[2],
+       _slcd_pending[0] ^ _slcd_committed[0], _slcd_pending[1] ^ _slcd_committed[1], _slcd_pending[2] ^ _slcd_committed[2]);
+    memcpy(_slcd_committed, _slcd_pending, sizeof(_slcd_committed));
+
+    return EM_FALSE;
 }
 
-void watch_clear_display(void) {
-    EM_ASM({
-        document.querySelectorAll("[data-com][data-seg]")
-            .forEach((e) => e.style.opacity = 0);
-    });
+void _watch_display_write_segments(void) {
+    // however often the app commits, the page gets at most one update per animation frame.
+    memcpy(_slcd_pending, Segment_Data, sizeof(_slcd_pending));
+    if (_slcd_flush_id != -1) return;
+    if (!memcmp(_slcd_committed, _slcd_pending, sizeof(_slcd_committed))) return;
+    _slcd_flush_id = emscripten_request_animation_frame(_watch_display_flush, NULL);
 }
 
 static void watch_invoke_blink_callback(void *userData) {
     blink_state = !blink_state;
     watch_display_character(blink_state ? blink_character : ' ', 7);
     watch_clear_pixel(2, 10); // clear segment B of position 7 since it can't blink
+    watch_display_commit();
 }
 
 void watch_start_character_blink(char character, uint32_t duration) {
@@ -76,11 +104,11 @@ void watch_start_character_blink(char character, uint32_t duration) {
 
     blink_state = true;
     blink_character = character;
-    blink_interval_id = emscripten_set_interval(watch_invoke_blink_callback, (double)duration, NULL);
+    blink_interval_id = main_loop_set_peripheral_timer(watch_invoke_blink_callback, NULL, duration, duration);
 }
 
 void watch_stop_blink(void) {
-    emscripten_clear_timeout(blink_interval_id);
+    main_loop_clear_timer(blink_interval_id);
     blink_interval_id = -1;
     blink_state = false;
 }
@@ -94,6 +122,7 @@ static void watch_invoke_tick_callback(void *userData) {
         watch_clear_pixel(0, 3);
         watch_set_pixel(0, 2);
     }
+    watch_display_commit();
 }
 
 void watch_start_tick_animation(uint32_t duration) {
@@ -101,7 +130,7 @@ void watch_start_tick_animation(uint32_t duration) {
     watch_display_character(' ', 8);
 
     tick_state = true;
-    tick_interval_id = emscripten_set_interval(watch_invoke_tick_callback, (double)duration, NULL);
+    tick_interval_id = main_loop_set_peripheral_timer(watch_invoke_tick_callback, NULL, duration, duration);
 }
 
 bool watch_tick_animation_is_running(void) {
@@ -109,7 +138,7 @@ bool watch_tick_animation_is_running(void) {
 }
 
 void watch_stop_tick_animation(void) {
-    emscripten_clear_timeout(tick_interval_id);
+    main_loop_clear_timer(tick_interval_id);
     tick_interval_id = -1;
     tick_state = false;
 